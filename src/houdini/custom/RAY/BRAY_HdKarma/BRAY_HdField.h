@@ -28,13 +28,13 @@
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/imaging/hd/field.h>
 #include <GT/GT_Handles.h>
-#include <UT/UT_Lock.h>
 #include <UT/UT_SmallArray.h>
 #include <UT/UT_StringHolder.h>
-#include <UT/UT_StringSet.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class BRAY_HdParam;
+
 ///
 /// HdField represents an actual data of field that might not be 
 /// actually renderable.
@@ -51,6 +51,7 @@ public:
     virtual void		Sync(HdSceneDelegate* sceneDelegate,
 				     HdRenderParam* renderParam,
 				     HdDirtyBits* dirtyBits) override;
+    void			Finalize(HdRenderParam *renderParam) override;
 
     GT_PrimitiveHandle		getGTPrimitive() const
 				{ return myField; }
@@ -64,15 +65,13 @@ public:
     const UT_SmallArray<GfMatrix4d>&	getXfms() const
 				{ return myXfm; }
 
-    /// Returns true if registered
-    bool			registerVolume(const UT_StringHolder& volume);
-
 protected:
 
     virtual HdDirtyBits		GetInitialDirtyBitsMask() const override
 				{ return AllDirty; }
 
-    void			dirtyVolumes(HdSceneDelegate* sceneDelegate);
+    void			dirtyVolumes(HdSceneDelegate* sceneDelegate,
+					     BRAY_HdParam& rparm);
 
 private:
 
@@ -83,7 +82,6 @@ private:
     UT_StringHolder 		myFilePath;
     UT_StringHolder		myFieldName;
     UT_SmallArray<GfMatrix4d>	myXfm;
-    UT_StringSet		myVolumes;
     int				myFieldIdx;
 };
 
@@ -32,8 +32,11 @@
 #include <UT/UT_Set.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_Map.h>
+#include <UT/UT_StopWatch.h>
+#include <UT/UT_ThreadSpecificValue.h>
 #include <UT/UT_UniquePtr.h>
 #include <BRAY/BRAY_Interface.h>
+#include <HUSD/XUSD_FieldVolumeMap.h>
 #include <HUSD/XUSD_RenderSettings.h>
 
 class UT_JSONWriter;
@@ -61,13 +64,29 @@ public:
 	UT_ASSERT(!myRenderer.isRendering());
     }
 
+    /// Only the first edit after a commitEdits() stops the render and bumps
+    /// the scene version. The render isn't restarted until the edits are
+    /// committed, so the rest of the edits from the same sync share it.
     BRAY::ScenePtr	&getSceneForEdit()
     {
-	stopRendering();
-	mySceneVersion.add(1);
+	if (!myEditsPending.load(SYS_MEMORY_ORDER_LOAD))
+	    beginEdits();
+	myEditCounts.get()++;
 	return myScene;
     }
 
+    /// End the current batch of scene edits. This must be called before the
+    /// render is restarted.
+    void	commitEdits();
+
+    /// Number of edit batches committed, the total number of edits in them,
+    /// and the number of edits and time in seconds from the first edit to
+    /// the commit of the last batch.
+    void	getEditStats(exint &batches,
+			exint &edits,
+			exint &last_edits,
+			fpreal64 &last_time) const;
+
     void	queueInstancer(HdSceneDelegate *sd, BRAY_HdInstancer *inst);
 
     /// Return true if the render has been stopped for processing
@@ -81,6 +100,10 @@ public:
     void	dump() const;
     void	dump(UT_JSONWriter &w) const;
 
+    /// Map of field bprims to the volume rprims that reference them.  This
+    /// can be updated from multiple threads during rprim sync.
+    XUSD_FieldVolumeMap	&fieldVolumeMap() { return myFieldVolumeMap; }
+
     /// Check if there's any shutter
     bool	validShutter() const
     {
@@ -154,6 +177,7 @@ public:
 
 private:
     exint	getQueueCount() const;
+    void	beginEdits();
 
     using QueuedInstances = UT_Set<BRAY_HdInstancer *>;
     UT_Array<QueuedInstances>    myQueuedInstancers;
@@ -174,6 +198,20 @@ private:
     bool                         myInstantShutter;
 
     UT_Set<UT_StringHolder>      myLightCategories;
+    XUSD_FieldVolumeMap          myFieldVolumeMap;
+
+    // Edits are counted per thread, since prims are synced in parallel.
+    UT_ThreadSpecificValue<exint> myEditCounts;
+    mutable UT_Lock              myEditLock;
+    UT_StopWatch                 myEditTimer;
+    // Set with release semantics once the render is stopped, so a thread
+    // that sees it set with an acquire load can edit the scene without
+    // taking myEditLock.
+    SYS_AtomicInt32              myEditsPending;
+    exint                        myEditBatches;
+    exint                        myEdits;
+    exint                        myLastBatchEdits;
+    fpreal64                     myLastBatchTime;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -95,6 +95,37 @@ public:
 	SdfPath		 myMaterial;
 	bool		 myResolved;
     };
+    /// Accounting of the primvar data handed from Hydra to Karma while
+    /// syncing a single rprim.  Arrays wrapping a VtArray (see gtArray())
+    /// are counted as aliased, any other buffer (interpolated motion samples,
+    /// velocity blur, flipped normals) is counted as copied.  Construct one
+    /// of these on the stack in a Sync() and add() the attributes that are
+    /// handed to the scene.  When it goes out of scope the totals are
+    /// reported to the error log at verbosity 4 or higher.
+    ///
+    /// The stats are owned by the sync and accumulated explicitly, since
+    /// Hydra syncs rprims in parallel and a sync may be interleaved with
+    /// other syncs on the same thread while it waits on nested tasks.
+    class PrimvarStats
+    {
+    public:
+	PrimvarStats(const SdfPath &id);
+	~PrimvarStats();
+
+	void	add(const GT_DataArrayHandle &data);
+	void	add(const GT_AttributeListHandle &alist);
+	/// Add all attribute lists on the primitive
+	void	add(const GT_PrimitiveHandle &prim);
+
+	exint	bytesAliased() const { return myAliased; }
+	exint	bytesCopied() const { return myCopied; }
+
+    private:
+	const SdfPath	&myId;
+	exint		 myAliased;
+	exint		 myCopied;
+    };
+
     /// Create a GT data array for the given source type
     template <typename A_TYPE> static
     GT_DataArrayHandle	gtArray(const A_TYPE &usd_array,
@@ -396,10 +427,15 @@ private:
 				int nseg,
 				const BRAY_HdParam &rparm);
 
+    /// Compute the velocity/acceleration blurred positions for all motion
+    /// segments in a single pass over the source arrays.  Segments with a
+    /// zero time offset share @c Parr, the others are views into one buffer.
     static
-    GT_DataArrayHandle	    computeBlur(const GT_DataArrayHandle& Parr,
+    void		    computeBlur(UT_Array<GT_DataArrayHandle>& p,
+				const GT_DataArrayHandle& Parr,
 				const fpreal32* P, const fpreal32* v,
-				const fpreal32* a, fpreal32 amount);
+				const fpreal32* a, const fpreal32* amounts,
+				int nseg);
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -26,8 +26,10 @@
  *     This plugin grant USD the power to use Houdini file protocol.
  *   The input path will be expanded then passed into FS_Reader. If
  *   an index file is detected, the stream of the called section will
- *   be fetched as a disk path in tmp folder. Otherwise this resolver
- *   will return the file path directly.
+ *   be fetched as a disk path in tmp folder. USD layers and SOP
+ *   references are instead read into memory when USD opens them, so
+ *   no file is written for them. Otherwise this resolver will return
+ *   the file path directly.
  *     The native resolver from Pixar uses PXR_AR_DEFAULT_SEARCH_PATH
  *   to search files. This feature is inherited to this plugin, but
  *   only works when FS_Reader return an invalid path.
@@ -164,17 +166,29 @@ private:
     {
 	FetchItem(UT_String ide, UT_String path) : 
 	    myIdentifier(ide), myFetchPath(path),
-	    myHasFetched(false), myFetchedSuccessfully(false) {} 
+	    myBufferSize(0), myFetchTime(0),
+	    myHasFetched(false), myFetchedSuccessfully(false),
+	    myInMemory(false) {} 
 
 	UT_Lock		 myLock;
 	UT_StringHolder	 myIdentifier;
 	UT_StringHolder	 myFetchPath;
+	// For items that are read into memory instead of being written to
+	// myFetchPath, the contents are shared by all the open assets, and
+	// are read again once all those assets are closed.
+	std::weak_ptr<const char> myBuffer;
+	size_t		 myBufferSize;
+	double		 myFetchTime;
 	bool		 myHasFetched;
 	bool		 myFetchedSuccessfully;
+	bool		 myInMemory;
     };
     typedef UT_IntrusivePtr<FetchItem> FetchPtr;
     typedef UT_ConcurrentHashMap<UT_StringHolder, FetchPtr> FetchMap;
 
+    // Return an asset holding the contents of an in-memory fetch item.
+    std::shared_ptr<ArAsset> _OpenMemoryAsset(FetchItem &item);
+
     // Private members
     TLSCacheScopeDataArray	 myTLSCacheScopeDataArray;
     FetchMap			 myFetchMap;
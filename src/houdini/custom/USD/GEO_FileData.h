@@ -22,6 +22,11 @@
 #include <GU/GU_DetailHandle.h>
 #include <UT/UT_UniquePtr.h>
 #include <UT/UT_Array.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_Set.h>
+#include <UT/UT_StringArray.h>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -45,14 +50,87 @@ public:
     /// store for editing so methods that modify the file are not supported.
     bool Open(const std::string &filePath) override;
 
+    /// Returns true if the property values are read from the geometry only
+    /// when they are asked for, instead of while opening the file.
+    bool deferProps() const
+	 { return myDeferProps; }
+
+    /// Returns true if the time samples are read from a sequence of files.
+    bool hasFrameSequence() const
+	 { return !myFrames.empty(); }
+
+    /// Returns the files referenced by packed disk primitives in the opened
+    /// geometry. The translation authors the extents of their geometry.
+    const UT_StringArray &externalFiles() const
+	 { return myExternalFiles; }
+
 protected:
 			 GEO_FileData();
                         ~GEO_FileData() override;
 
+    // When the "framepattern" and "framerange" arguments are given, every
+    // frame of the sequence is a time sample of this layer. The prims and
+    // properties of the layer come from the opened file, and the values of
+    // the other frames are read from their own files the first time they
+    // are asked for. A frame that is missing a prim or property (or can't
+    // be read) uses the value from the opened file.
+    std::set<double> getSampleFrames() const override;
+    bool copySample(const SdfPath &id,
+                    const GEO_FileProp &prop,
+                    double frame,
+                    const GEO_FileFieldValue &value) const override;
+    // A request for all the samples of a property reads every frame once,
+    // in order, and gathers the samples of that property and of as many
+    // other properties as fit in a fixed memory budget. Each
+    // property's samples are released when they are asked for, so writing
+    // out the layer reads the sequence a few times rather than once for
+    // every property, without holding every sample in memory.
+    bool copySamples(const SdfPath &id,
+                     const GEO_FileProp &prop,
+                     SdfTimeSampleMap &samples) const override;
+
 private:
+    typedef std::pair<double, GEO_FileDataRefPtr> FrameEntry;
+
+    // Returns the data for one frame of the sequence, reading the frame if
+    // it isn't resident. Returns null if the frame is the opened file.
+    GEO_FileDataRefPtr	 loadFrame(double frame) const;
+    // Returns the property in the data for one frame, or prop itself if
+    // the frame is the opened file or doesn't have the property. Topology
+    // that hasn't changed since the opened file is also read from prop, so
+    // the frame never converts its own copy.
+    const GEO_FileProp	&getFrameProp(const GEO_FileDataRefPtr &framedata,
+				const SdfPath &id,
+				const GEO_FileProp &prop) const;
+    // Gathers the samples of the property id, and of other properties that
+    // haven't been gathered yet, into mySampleCache.
+    void		 prefetchSamples(const SdfPath &id,
+				const GEO_FileProp &prop) const;
+
     GEO_FilePrim			*myLayerInfoPrim;
     SdfFileFormat::FileFormatArguments	 myCookArgs;
+    std::string				 myFilePath;
+    UT_StringArray			 myExternalFiles;
+    // The detail of a SOP layer with deferred properties. Our preserve
+    // request stops the SOP from modifying it in place while deferred
+    // properties may still read it.
+    GU_DetailHandle			 mySopGdh;
     bool				 mySaveSampleFrame;
+    bool				 myDeferProps;
+    exint				 myNumPrimitives;
+    exint				 myNumVertices;
+
+    // The frame sequence. Only myFrameWindow frames are kept in memory,
+    // ordered from least to most recently used.
+    std::string				 myOpenPath;
+    std::string				 myFramePattern;
+    std::set<double>			 myFrames;
+    exint				 myFrameWindow;
+    mutable UT_Array<FrameEntry>	 myResidentFrames;
+    mutable UT_Lock			 myFrameLock;
+    mutable UT_Map<SdfPath, SdfTimeSampleMap, SdfPath::Hash> mySampleCache;
+    mutable UT_Set<SdfPath, SdfPath::Hash> myPrefetchedProps;
+    mutable UT_Lock			 mySampleLock;
 
     friend class GEO_FilePrim;
 };
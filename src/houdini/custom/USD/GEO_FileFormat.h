@@ -20,6 +20,7 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/base/tf/staticTokens.h"
+#include <SYS/SYS_Types.h>
 #include <iosfwd>
 #include <string>
 
@@ -34,6 +35,26 @@ TF_DECLARE_PUBLIC_TOKENS(GEO_FileFormatTokens, GEO_FILE_FORMAT_TOKENS);
 TF_DECLARE_WEAK_AND_REF_PTRS(GEO_FileFormat);
 TF_DECLARE_WEAK_AND_REF_PTRS(SdfLayerBase);
 
+class UT_StringArray;
+
+/// Number of geometry files translated and of the files read from and
+/// written to the translation cache (see HOUDINI_BGEO_TO_USD_CACHE_DIR),
+/// with the total time spent on each. Comparing the average translation
+/// time with the average cache read time gives the cold and warm cost of
+/// opening a geometry file.
+struct GEO_FileCacheStats
+{
+    exint	 myTranslations = 0;
+    fpreal64	 myTranslateTime = 0;
+    exint	 myCacheReads = 0;
+    fpreal64	 myCacheReadTime = 0;
+    exint	 myCacheWrites = 0;
+    fpreal64	 myCacheWriteTime = 0;
+    // Cache files deleted to keep the cache directory under its maximum
+    // size (see HOUDINI_BGEO_TO_USD_CACHE_MAX_SIZE).
+    exint	 myCacheEvictions = 0;
+};
+
 /// \class GEO_FileFormat
 ///
 class GEO_FileFormat : public SdfFileFormat
@@ -65,6 +86,15 @@ public:
 					std::ostream& out,
 					size_t indent) const override;
 
+    static void			 getCacheStats(GEO_FileCacheStats &stats);
+    // Counts the properties of a layer translated from geometry, and how
+    // many of their values have been read. This shows how much work
+    // deferring the properties saved. Returns false if the layer wasn't
+    // translated by this file format (or was read from the cache).
+    static bool			 getPropStats(const SdfLayerHandle &layer,
+					exint &numProps,
+					exint &numTouched);
+
 protected:
     SDF_FILE_FORMAT_FACTORY_ACCESS;
 
@@ -72,7 +102,16 @@ protected:
                                 ~GEO_FileFormat() override;
 
 private:
+    bool			 readFromCache(SdfLayer *layer,
+					const std::string &cachePath,
+					bool metadataOnly) const;
+    void			 writeToCache(const SdfLayer &layer,
+					const std::string &cachePath,
+					const UT_StringArray &externalFiles)
+					const;
+
     SdfFileFormatConstPtr	myUsda;
+    SdfFileFormatConstPtr	myUsdc;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
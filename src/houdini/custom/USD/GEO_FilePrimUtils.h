@@ -84,6 +84,8 @@ public:
     bool                         myTranslateUVToST = true;
     bool                         mySetDefaultPrim = true;
     bool                         myHeightfieldConvert = false;
+    // Only convert attribute values when they are first read.
+    bool                         myDeferProps = false;
 };
 
 void 
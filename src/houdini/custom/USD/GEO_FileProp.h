@@ -69,6 +69,9 @@ public:
     const GEO_FileMetadata	&getCustomData() const
 				 { return myCustomData; }
     bool			 copyData(const GEO_FileFieldValue &v) const;
+    // Returns true if the value has been read with copyData().
+    bool			 getTouched() const
+				 { return myPropSource->getTouched(); }
 
     // Add metadata or custom data to a property.
     // The "add" methods use emplace, and so do not replace existing values.
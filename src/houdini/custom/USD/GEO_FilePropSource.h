@@ -20,7 +20,9 @@
 #include "pxr/pxr.h"
 #include "GEO_FileFieldValue.h"
 #include <GT/GT_DataArray.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Lock.h>
 #include <UT/UT_NonCopyable.h>
 #include <UT/UT_TBBSpinLock.h>
 #include <pxr/base/vt/array.h>
@@ -32,15 +34,61 @@ class GEO_FilePropSource : public UT_IntrusiveRefCounter<GEO_FilePropSource>,
 {
 public:
 			 GEO_FilePropSource()
+			     : myTouched(0)
 			 { }
     virtual		~GEO_FilePropSource()
 			 { }
 
     virtual bool	 copyData(const GEO_FileFieldValue &value) = 0;
+
+    // Tracks whether the value of the property has ever been read.
+    bool		 getTouched() const
+			 { return myTouched.relaxedLoad() != 0; }
+    void		 setTouched()
+			 { myTouched.store(1); }
+
+private:
+    SYS_AtomicInt32	 myTouched;
 };
 
 typedef UT_IntrusivePtr<GEO_FilePropSource> GEO_FilePropSourceHandle;
 
+// Holds on to an attribute and only builds the SourceT for it the first time
+// its value is read. The attribute keeps the detail it came from alive until
+// then. Used to avoid converting attributes that are never read.
+template<class SourceT>
+class GEO_FilePropDeferredSource : public GEO_FilePropSource
+{
+public:
+			 GEO_FilePropDeferredSource(
+				 const GT_DataArrayHandle &attrib)
+			     : myAttrib(attrib)
+			 { }
+
+    bool	         copyData(const GEO_FileFieldValue &value) override
+			 {
+			    GEO_FilePropSourceHandle	 source;
+
+			    {
+				UT_Lock::Scope	 lock(myLock);
+
+				if (!mySource)
+				{
+				    mySource = new SourceT(myAttrib);
+				    myAttrib.reset();
+				}
+				source = mySource;
+			    }
+
+			    return source->copyData(value);
+			 }
+
+private:
+    GT_DataArrayHandle		 myAttrib;
+    GEO_FilePropSourceHandle	 mySource;
+    UT_Lock			 myLock;
+};
+
 template<class T, class ComponentT = T>
 class GEO_FilePropAttribSource : public GEO_FilePropSource
 {
@@ -112,6 +112,8 @@ public:
 
     ~GEO_FileRefiner() override;
 
+    // Primitives are added in order. refineDetail() refines partitions to
+    // GT primitives in parallel before adding them.
     bool allowThreading() const override { return false; }
 
     void addPrimitive( const GT_PrimitiveHandle& gtPrim ) override;
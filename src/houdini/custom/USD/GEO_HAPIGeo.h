@@ -37,6 +37,9 @@ public:
 
     GEO_HAPIPartArray &getParts() { return myParts; }
 
+    // Approximate memory used by the data loaded for all parts
+    int64 getMemoryUsage() const;
+
 private:
     GEO_HAPIPartArray myParts;
 };
@@ -61,6 +61,9 @@ public:
     UT_BoundingBoxR getBounds() const;
     UT_Matrix4D getXForm() const;
 
+    // Approximate memory used by the data loaded for this part
+    int64 getMemoryUsage() const;
+
     HAPI_PartType getType() const { return myType; }
     bool isInstancer() const { return myType == HAPI_PARTTYPE_INSTANCER; }
 
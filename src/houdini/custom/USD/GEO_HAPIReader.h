@@ -21,6 +21,7 @@
 #include "GEO_HAPISessionManager.h"
 #include <HAPI/HAPI.h>
 #include <UT/UT_Array.h>
+#include <UT/UT_Map.h>
 
 typedef std::pair<fpreal32, GEO_HAPIGeoHandle> GEO_HAPITimeSample;
 typedef std::map<std::string, std::string> GEO_HAPIParameterMap;
@@ -34,7 +35,9 @@ enum GEO_HAPITimeCaching
     // Cache time samples as they are requested
     GEO_HAPI_TIME_CACHING_CONTINUOUS,
 
-    // Immediately cache all time samples within a specified range and interval
+    // Immediately cache all time samples within a specified range and interval.
+    // Long ranges are split between several HAPI sessions and cooked in
+    // parallel
     GEO_HAPI_TIME_CACHING_RANGE
 };
 
@@ -45,6 +48,12 @@ struct GEO_HAPITimeCacheInfo
     fpreal32 myEndTime = 1.0f;
     fpreal32 myInterval = 1.0f / 24.0f;
 
+    // When the cached geometry uses more than this many bytes, the least
+    // recently used time samples are evicted. Evicted samples are cooked
+    // again when requested. Zero means no limit. This doesn't affect the
+    // comparison operators, because changing it doesn't invalidate the cache
+    int64 myMaxMemory = 0;
+
     bool operator==(const GEO_HAPITimeCacheInfo &rhs);
     bool operator!=(const GEO_HAPITimeCacheInfo &rhs);
 };
@@ -85,10 +94,36 @@ public:
     GEO_HAPIGeoHandle getGeo(float time = 0.0f);
 
 private:
-
-    bool updateParms(const HAPI_Session &session,
-                     const HAPI_NodeInfo &assetInfo,
-                     UT_WorkBuffer &buf);
+    // Cooks the time samples of a range that aren't cached yet. The samples
+    // are split between this reader's session and idle sessions from the
+    // pool that already loaded this asset library. Parts that fail in a
+    // borrowed session are cooked again in this reader's session. Returns
+    // false if the range is too short to be worth splitting or there are no
+    // such sessions, in which case nothing was cooked. Must be called
+    // without holding the lock on this reader's session.
+    //
+    // This is opt-in: the pool only holds one session unless
+    // HOUDINI_USD_HAPI_SESSIONS is set higher, and sessions are only
+    // borrowed once other readers have loaded the same asset library into
+    // them. Otherwise the range is cooked serially, as before
+    bool prefetchRange(const GEO_HAPIParameterMap &parmMap,
+                       const GEO_HAPITimeCacheInfo &cacheInfo);
+
+    // Marks the geometry at time as the most recently used
+    void useGeo(float time);
+
+    // Evicts the least recently used geometry until the cache uses at most
+    // maxMemory bytes. The geometry at keepTime is never evicted
+    void evictGeos(int64 maxMemory, float keepTime);
+
+    // Holds a reference to the geometry so its address can't be reused by
+    // newer geometry while it is still a key in myGeoUsage
+    struct GeoUsage
+    {
+        GEO_HAPIGeoHandle myGeo;
+        exint myLastUsed = 0;
+        int64 myMemory = -1;
+    };
 
     UT_StringHolder myAssetName;
     bool myUsingDefaultAssetName;
@@ -101,6 +136,8 @@ private:
     HAPI_NodeId myAssetId;
 
     UT_Array<GEO_HAPITimeSample> myGeos;
+    UT_Map<const GEO_HAPIGeo *, GeoUsage> myGeoUsage;
+    exint myUseCounter;
     GEO_HAPITimeCacheInfo myTimeCacheInfo;
     bool myReadSuccess;
 };
@@ -18,25 +18,76 @@
 #define __GEO_HAPI_SESSION_MANAGER_H__
 
 #include <HAPI/HAPI.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_Lock.h>
+#include <UT/UT_StopWatch.h>
+#include <UT/UT_StringMap.h>
+#include <SYS/SYS_AtomicInt.h>
 
 typedef exint GEO_HAPISessionID;
 
+/// Usage statistics for one session in the pool
+struct GEO_HAPISessionStats
+{
+    GEO_HAPISessionID myId;
+    // Number of registered users
+    int myUserCount;
+    // Number of threads currently waiting to lock the session, and the most
+    // that have ever waited at once
+    int myWaiting;
+    int myMaxWaiting;
+    // Number of times the session was locked, the total time it was locked,
+    // and the time since the session was created
+    exint myLockCount;
+    fpreal64 myBusyTime;
+    fpreal64 myLifeTime;
+};
+
 /// \class GEO_HAPISessionManager
 ///
 /// Class to manage HAPI sessions used by multiple objects
 ///
+/// Users are spread over a pool of independent sessions so they can cook in
+/// parallel. A user keeps its session (and the assets it loaded there) until
+/// it unregisters. Each session is a separate process that takes a license,
+/// so the pool size defaults to 1, and can be raised with the
+/// HOUDINI_USD_HAPI_SESSIONS environment variable.
+///
 class GEO_HAPISessionManager
 {
 public:
     GEO_HAPISessionManager();
 
     // Must be called to use a shared session. Returns a GEO_HAPISessionID to be
-    // used to access the session. A session remains open until all registered
-    // users call unregister(). If the session fails to initialize, this will
-    // return -1. Valid ids are never negative
+    // used to access the session. The user is given an idle session with the
+    // fewest users, or a new session if every session is full or busy
+    // cooking and the pool isn't full. A session remains open until all
+    // registered users call unregister(). If the session fails to
+    // initialize, this will return -1. Valid ids are never negative
     static GEO_HAPISessionID registerAsUser();
 
+    // Records that a user loaded the asset library at path, last modified at
+    // modTime, into the session
+    static void addLoadedLibrary(GEO_HAPISessionID id,
+                                 const UT_StringHolder &path,
+                                 exint modTime);
+
+    // Registers as a user of an open session that isn't busy cooking, isn't
+    // one of the exclude sessions, and already loaded the same version of
+    // the asset library. Never starts a new session. Returns -1 if there is
+    // no such session. Otherwise the id must be passed to unregister()
+    static GEO_HAPISessionID registerAsWarmUser(
+        const UT_StringHolder &path,
+        exint modTime,
+        const UT_Array<GEO_HAPISessionID> &exclude);
+
+    // Returns usage statistics for all open sessions
+    static void getStats(UT_Array<GEO_HAPISessionStats> &stats);
+
+    // Returns the number of sessions the pool will open before users have to
+    // share them
+    static int maxSessions();
+
     // Notifies the manager that the session is no longer being used. Should be
     // called once with the id returned from registerAsUser(). Using id after
     // this call will result in undefined behaviour
@@ -94,10 +145,25 @@ private:
 
     bool createSession(GEO_HAPISessionID id);
     void cleanupSession();
+    void fillStats(GEO_HAPISessionID id, GEO_HAPISessionStats &stats) const;
 
     int myUserCount;
     HAPI_Session mySession;
     UT_Lock myLock;
+
+    // Number of threads holding or waiting for myLock
+    SYS_AtomicInt32 myActive;
+    // Modification times of the asset libraries loaded into the session
+    UT_StringMap<exint> myLibraries;
+
+    // Statistics, which can be read while another thread holds myLock.
+    // myBusyTimer is only used while holding myLock.
+    SYS_AtomicInt32 myWaiting;
+    SYS_AtomicInt32 myMaxWaiting;
+    SYS_AtomicInt64 myLockCount;
+    SYS_AtomicInt64 myBusyMicroseconds;
+    UT_StopWatch myBusyTimer;
+    UT_StopWatch myLifeTimer;
 };
 
 #endif // __GEO_HAPI_SESSION_MANAGER_H__
@@ -88,12 +88,32 @@ public:
                        const VtValue &) override;
     void EraseTimeSample(const SdfPath &, double) override;
 
+    // Counts the properties of all prims, and how many of them have had
+    // their values read.
+    void getPropStats(exint &numProps, exint &numTouched) const;
+
 protected:
     GEO_SceneDescriptionData();
     ~GEO_SceneDescriptionData() override;
 
     const GEO_FilePrim *getPrim(const SdfPath &id) const;
 
+    // The time samples of every property that doesn't hold a default value.
+    // By default there is at most one sample, at mySampleFrame. Subclasses
+    // that read several frames override these.
+    virtual std::set<double> getSampleFrames() const;
+    // Copy the value of a property at one of the sample frames. If value is
+    // empty, only returns whether the property has a sample at the frame.
+    virtual bool copySample(const SdfPath &id,
+                            const GEO_FileProp &prop,
+                            double frame,
+                            const GEO_FileFieldValue &value) const;
+    // Copy the values of a property at all of the sample frames. By default
+    // this calls copySample for each frame in turn.
+    virtual bool copySamples(const SdfPath &id,
+                             const GEO_FileProp &prop,
+                             SdfTimeSampleMap &samples) const;
+
     // SdfAbstractData overrides
     void _VisitSpecs(
         SdfAbstractDataSpecVisitor *visitor) const override;
@@ -44,6 +44,7 @@ set( husd_sources
     HUSD_HydraLight.C
     HUSD_HydraMaterial.C
     HUSD_HydraPrim.C
+    HUSD_IDSet.C
     HUSD_Imaging.C
     HUSD_Info.C
     HUSD_KarmaShaderTranslator.C
@@ -86,7 +87,10 @@ set( husd_sources
 
     XUSD_AttributeUtils.C
     XUSD_AutoCollection.C
+    XUSD_AutoCollectionIndex.C
+    XUSD_BoundsHierarchy.C
     XUSD_Data.C
+    XUSD_FieldVolumeMap.C
     XUSD_FindPrimsTask.C
     XUSD_HydraCamera.C
     XUSD_HydraField.C
@@ -95,6 +99,7 @@ set( husd_sources
     XUSD_HydraLight.C
     XUSD_HydraMaterial.C
     XUSD_HydraUtils.C
+    XUSD_LayerJournal.C
     XUSD_MirrorRootLayerData.C
     XUSD_OverridesData.C
     XUSD_PathPattern.C
@@ -153,6 +158,7 @@ set( husd_hdk_headers
     HUSD_GeoUtils.h
     HUSD_GetAttributes.h
     HUSD_GetMetadata.h
+    HUSD_IDSet.h
     HUSD_Imaging.h
     HUSD_Info.h
     HUSD_KarmaShaderTranslator.h
@@ -195,19 +201,24 @@ set( husd_hdk_headers
 
     XUSD_AttributeUtils.h
     XUSD_AutoCollection.h
+    XUSD_AutoCollectionIndex.h
+    XUSD_BoundsHierarchy.h
     XUSD_Data.h
     XUSD_DataLock.h
+    XUSD_FieldVolumeMap.h
     XUSD_FindPrimsTask.h
     XUSD_Format.h
     XUSD_HydraInstancer.h
     XUSD_HydraRenderBuffer.h
     XUSD_HydraUtils.h
+    XUSD_LayerJournal.h
     XUSD_MirrorRootLayerData.h
     XUSD_OverridesData.h
     XUSD_PathPattern.h
     XUSD_PathSet.h
     XUSD_PerfMonAutoCookEvent.h
     XUSD_RenderSettings.h
+    XUSD_StageCacheRegistry.h
     XUSD_Ticket.h
     XUSD_TicketRegistry.h
     XUSD_Tokens.h
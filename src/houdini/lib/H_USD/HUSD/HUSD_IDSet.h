@@ -0,0 +1,118 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __HUSD_IDSet_h__
+#define __HUSD_IDSet_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_Array.h>
+#include <SYS/SYS_Types.h>
+
+/// A set of the integer ids of a HUSD_Scene, used for selections and
+/// highlights. The ids are split into chunks of 65536 consecutive values.
+/// A chunk holding a few ids keeps them in a sorted array, and a chunk
+/// holding many keeps a bitmap. Instance ids are handed out consecutively,
+/// so selecting millions of instances costs about one bit per instance
+/// instead of one hash table entry.
+class HUSD_API HUSD_IDSet
+{
+public:
+			 HUSD_IDSet();
+			~HUSD_IDSet();
+
+    bool		 operator==(const HUSD_IDSet &other) const;
+    bool		 operator!=(const HUSD_IDSet &other) const
+			 { return !(*this == other); }
+
+    bool		 empty() const
+			 { return mySize == 0; }
+    exint		 size() const
+			 { return mySize; }
+    bool		 contains(int id) const;
+    // Return true if the id was added or removed.
+    bool		 insert(int id);
+    bool		 erase(int id);
+    void		 clear();
+    void		 swap(HUSD_IDSet &other);
+
+    int64		 getMemoryUsage(bool inclusive) const;
+
+    /// Iterates over the ids in increasing order.
+    class const_iterator
+    {
+    public:
+			 const_iterator()
+			     : mySet(nullptr), myChunk(0), myPos(0) {}
+
+	int		 operator*() const
+			 { return mySet->idAt(myChunk, myPos); }
+	const_iterator	&operator++()
+			 { mySet->advance(myChunk, myPos); return *this; }
+	bool		 operator==(const const_iterator &other) const
+			 { return myChunk == other.myChunk &&
+				  myPos == other.myPos; }
+	bool		 operator!=(const const_iterator &other) const
+			 { return !(*this == other); }
+
+    private:
+			 const_iterator(const HUSD_IDSet *set,
+				exint chunk, exint pos)
+			     : mySet(set), myChunk(chunk), myPos(pos) {}
+
+	const HUSD_IDSet *mySet;
+	exint		 myChunk;
+	exint		 myPos;
+
+	friend class HUSD_IDSet;
+    };
+
+    const_iterator	 begin() const;
+    const_iterator	 end() const;
+
+private:
+    class Chunk
+    {
+    public:
+	bool		 isBitmap() const
+			 { return myBits.entries() > 0; }
+
+	uint32		 myKey;
+	exint		 myCount;
+	// Sorted low 16 bits of the ids when the chunk is sparse.
+	UT_Array<uint16> myValues;
+	// One bit per id when the chunk is dense.
+	UT_Array<uint64> myBits;
+    };
+
+    // Index of the first chunk with a key not less than the given key.
+    exint		 findChunk(uint32 key) const;
+    exint		 firstPos(exint chunk) const;
+    int			 idAt(exint chunk, exint pos) const;
+    void		 advance(exint &chunk, exint &pos) const;
+
+    UT_Array<Chunk>	 myChunks;
+    exint		 mySize;
+};
+
+#endif
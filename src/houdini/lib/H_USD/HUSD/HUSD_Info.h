@@ -51,6 +51,10 @@ public:
     static bool		 isPrimvarName(const UT_StringRef &name);
     static void		 getPrimitiveKinds(UT_StringArray &kinds);
     static void          getUsdVersionInfo(UT_StringMap<UT_StringHolder> &info);
+    // Hit and miss counts of the caches used to answer stage queries and
+    // compute packed USD bounds, and how often layer journals avoided
+    // copying whole layers.
+    static void          getCacheStats(UT_Options &stats);
     static bool		 reload(const UT_StringRef &filepath, bool recursive);
     static const UT_StringHolder &getIconForPrimType(
                                 const UT_StringHolder &primtype,
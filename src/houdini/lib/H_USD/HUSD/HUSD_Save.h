@@ -31,6 +31,7 @@
 #include <UT/UT_PathPattern.h>
 #include <UT/UT_StringHolder.h>
 #include <UT/UT_UniquePtr.h>
+#include <SYS/SYS_Math.h>
 #include <SYS/SYS_Types.h>
 
 enum HUSD_SaveStyle {
@@ -110,7 +111,13 @@ public:
 			 HUSD_Save();
 			~HUSD_Save();
 
-    bool		 addCombinedTimeSample(const HUSD_AutoReadLock &lock);
+    /// Adds a time sample to be written by saveCombined. If a time sample
+    /// window is set and a filepath is given, each full window of samples
+    /// is written out and released here instead. The filepath must be the
+    /// one later passed to saveCombined.
+    bool		 addCombinedTimeSample(const HUSD_AutoReadLock &lock,
+				const UT_StringRef &filepath = UT_StringRef(),
+                                bool filepath_is_time_dependent = false);
     bool		 saveCombined(const UT_StringRef &filepath,
                                 bool filepath_is_time_dependent,
 				UT_StringArray &saved_paths);
@@ -217,11 +224,27 @@ public:
     void                 setOutputProcessorsTime(fpreal t)
                          { myProcessorData.myConfigTime = t; }
 
-
+    /// The number of time samples kept in memory before they are written
+    /// out by addCombinedTimeSample. Each window of samples is saved to its
+    /// own set of files next to the files it is part of, and saveCombined
+    /// writes each output file as a layer that combines its windows with
+    /// value clips. This keeps memory use bounded when saving long frame
+    /// ranges. Zero keeps every sample in memory until saveCombined is
+    /// called.
+    exint                timeSampleWindow() const
+                         { return myTimeSampleWindow; }
+    void                 setTimeSampleWindow(exint window)
+                         { myTimeSampleWindow = SYSmax(window, exint(0)); }
 
 private:
     class		 husd_SavePrivate;
 
+    bool		 addTimeSample(const HUSD_AutoReadLock &lock);
+    bool		 writeCombined(const UT_StringRef &filepath,
+                                bool filepath_is_time_dependent);
+    bool		 writeWindow(const UT_StringRef &filepath,
+                                bool filepath_is_time_dependent);
+
     UT_UniquePtr<husd_SavePrivate>	 myPrivate;
     UT_UniquePtr<UT_PathPattern>	 mySaveFilesPattern;
     HUSD_SaveStyle			 mySaveStyle;
@@ -229,6 +252,7 @@ private:
     husd_SaveDefaultPrimData		 myDefaultPrimData;
     husd_SaveTimeData                    myTimeData;
     husd_SaveConfigFlags                 myFlags;
+    exint                                myTimeSampleWindow;
 };
 
 #endif
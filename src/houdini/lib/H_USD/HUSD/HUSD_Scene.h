@@ -42,6 +42,7 @@
 #include <UT/UT_Vector2.h>
 #include <SYS/SYS_Types.h>
 #include <GT/GT_Primitive.h>
+#include "HUSD_IDSet.h"
 #include "HUSD_PrimHandle.h"
 #include "HUSD_HydraPrim.h"
 #include "HUSD_Overrides.h"
@@ -49,6 +50,7 @@
 PXR_NAMESPACE_OPEN_SCOPE
 class XUSD_ViewerDelegate;
 class XUSD_HydraInstancer;
+class XUSD_FieldVolumeMap;
 class HdRenderIndex;
 class HdRenderParam;
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -180,11 +182,14 @@ public:
 
     HUSD_HydraGeoPrimPtr findConsolidatedPrim(int id) const;
     
-    // Volumes
-    const UT_StringSet &volumesUsingField(const UT_StringRef &field) const;
+    // Volumes. These may be called from multiple threads during a Hydra sync.
+    void volumesUsingField(const UT_StringRef &field,
+			   UT_StringArray &volumes) const;
     void addVolumeUsingField(const UT_StringHolder &volume,
 			     const UT_StringHolder &field);
     void removeVolumeUsingFields(const UT_StringRef &volume);
+    PXR_NS::XUSD_FieldVolumeMap &fieldVolumeMap()
+			     { return *myFieldsInVolumes; }
 
     // Selections. A highlight is a temporary selection which can be turned into
     // a selection in various ways.
@@ -262,6 +267,13 @@ public:
 
     int		getOrCreateID(const UT_StringRef &path,
                               PrimType type = GEOMETRY);
+    // Fills ids with the ids of the first ids.entries() instances of one
+    // prototype of a top level point instancer. This is the same as calling
+    // getOrCreateID() with the key of each instance, without building the
+    // keys.
+    void	getOrCreateInstanceIDs(const UT_StringRef &instancer,
+                                       const UT_StringRef &prototype,
+                                       UT_IntArray &ids);
     
     void	setStage(const HUSD_DataHandle &data,
 			 const HUSD_ConstOverridesPtr &overrides);
@@ -306,7 +318,7 @@ protected:
                                      int path_id) const;
 
     void         stashSelection();
-    bool         makeSelection(const UT_Map<int,int> &selection,
+    bool         makeSelection(const HUSD_IDSet &selection,
                                bool validate);
     int          getIDForPrim(const UT_StringRef &path,
                               PrimType &return_prim_type,
@@ -320,7 +332,7 @@ protected:
     UT_Map<int,UT_StringHolder>		myRenderPaths;
     UT_StringMap<int>                   myRenderIDs;
     UT_Map<int,int>                     myRenderIDtoGeomID;
-    UT_StringMap<UT_StringSet>		myFieldsInVolumes;
+    PXR_NS::XUSD_FieldVolumeMap	       *myFieldsInVolumes;
     UT_StringMap<HUSD_HydraGeoPrimPtr>	myGeometry;
     UT_StringMap<HUSD_HydraGeoPrimPtr>	myDisplayGeometry;
     UT_StringMap<HUSD_HydraCameraPtr>	myCameras;
@@ -338,8 +350,8 @@ protected:
     UT_StringHolder                     myCurrentRenderPrim;
     UT_StringHolder                     myDefaultRenderPrim;
 
-    UT_Map<int,int>			myHighlight;
-    UT_Map<int,int>			mySelection;
+    HUSD_IDSet				myHighlight;
+    HUSD_IDSet				mySelection;
     UT_StringMap<int64>			myMatIDs;
     UT_StringArray			mySelectionArray;
     int64				mySelectionArrayID;
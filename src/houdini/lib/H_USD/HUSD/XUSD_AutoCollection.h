@@ -121,6 +121,13 @@ public:
     virtual bool         matchPrimitive(const UsdPrim &prim,
                                 bool *prune_branch) const = 0;
 
+    /// Collections that can be answered from the XUSD_AutoCollectionIndex
+    /// of the stage add their matches and return true. Otherwise the stage
+    /// is traversed, testing each prim with matchPrimitive.
+    virtual bool         matchPrimitivesFromIndex(const UsdStageRefPtr &stage,
+                                HUSD_PrimTraversalDemands demands,
+                                XUSD_PathSet &matches) const;
+
 protected:
     void                 setTokenParsingError(const UT_StringHolder &error)
                          { myTokenParsingError = error; }
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_AutoCollectionIndex_h__
+#define __XUSD_AutoCollectionIndex_h__
+
+#include "HUSD_API.h"
+#include "HUSD_Utils.h"
+#include "XUSD_PathSet.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/base/tf/weakBase.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class XUSD_AutoCollectionIndex;
+typedef UT_SharedPtr<XUSD_AutoCollectionIndex> XUSD_AutoCollectionIndexPtr;
+
+/// Lookup tables from the kind, prim type, purpose, composition arcs, and
+/// instance master of every traversable prim on a stage to the paths of the
+/// prims, used to evaluate the built in auto collections without testing
+/// every prim on the stage. One of these is kept per stage and traversal
+/// predicate. Each table is only built the first time it is needed, and is
+/// thrown away when a change notice from the stage could affect it.
+class HUSD_API XUSD_AutoCollectionIndex : public TfWeakBase,
+					  UT_NonCopyable
+{
+public:
+    enum IndexType {
+	INDEX_KIND,
+	INDEX_TYPE,
+	INDEX_PURPOSE,
+	INDEX_REFERENCE,
+	INDEX_INSTANCE,
+	NUM_INDEX_TYPES
+    };
+
+			 XUSD_AutoCollectionIndex(const UsdStageRefPtr &stage,
+				HUSD_PrimTraversalDemands demands);
+			~XUSD_AutoCollectionIndex();
+
+    /// Return the shared index for this stage and traversal, creating it if
+    /// it doesn't exist yet.
+    static XUSD_AutoCollectionIndexPtr	 find(const UsdStageRefPtr &stage,
+					HUSD_PrimTraversalDemands demands);
+
+    /// Number of queries answered by a table that was already built (hits)
+    /// and by a table that had to be built first (misses). These are
+    /// reported by HUSD_Info::getCacheStats().
+    static void		 getStats(IndexType type,
+				exint &hits,
+				exint &misses);
+    static void		 clearStats();
+
+    /// The stage passed to each of these methods must be the one this index
+    /// was created for. Matching paths are added to the path set.
+
+    /// Add prims with a kind derived from the requested kind. If model_only
+    /// is true, only prims that are part of the contiguous model hierarchy
+    /// are considered.
+    void		 findKind(const UsdStageRefPtr &stage,
+				const TfToken &kind,
+				bool model_only,
+				XUSD_PathSet &paths);
+    /// Add prims whose schema type derives from any of the types.
+    void		 findTypes(const UsdStageRefPtr &stage,
+				const UT_Array<const TfType *> &types,
+				XUSD_PathSet &paths);
+    /// Add prims with any of the computed purposes.
+    void		 findPurposes(const UsdStageRefPtr &stage,
+				const TfTokenVector &purposes,
+				XUSD_PathSet &paths);
+    /// Add prims with a direct reference, inherit, or specialize arc to the
+    /// prim at ref_path in the root layer stack.
+    void		 findReferences(const UsdStageRefPtr &stage,
+				const SdfPath &ref_path,
+				XUSD_PathSet &paths);
+    /// Add instance prims with the master at master_path.
+    void		 findInstances(const UsdStageRefPtr &stage,
+				const SdfPath &master_path,
+				XUSD_PathSet &paths);
+
+    /// The stage this was created for.
+    const UsdStageWeakPtr &stage() const
+			 { return myStage; }
+
+private:
+    typedef UT_Map<TfToken, XUSD_PathSet, TfToken::HashFunctor> TokenTable;
+    typedef UT_Map<SdfPath, XUSD_PathSet, SdfPath::Hash>	PathTable;
+
+    // All prims with one prim type name share a schema type, so a single
+    // prim is enough to test the whole group against a requested type.
+    class xusd_TypeEntry
+    {
+    public:
+	UsdPrim			 myPrim;
+	XUSD_PathSet		 myPaths;
+    };
+
+    bool			 matches(const UsdStage *stage,
+					HUSD_PrimTraversalDemands demands) const;
+    void			 objectsChanged(
+					const UsdNotice::ObjectsChanged &notice,
+					const UsdStageWeakPtr &sender);
+
+    // Returns true if the table was already built.
+    bool			 prepare(const UsdStageRefPtr &stage,
+					IndexType type);
+    void			 buildPrims(const UsdStageRefPtr &stage);
+    void			 buildKinds();
+    void			 buildTypes();
+    void			 buildPurposes();
+    void			 buildReferences();
+    void			 buildInstances();
+
+    UsdStageWeakPtr				 myStage;
+    HUSD_PrimTraversalDemands			 myDemands;
+    Usd_PrimFlagsPredicate			 myPredicate;
+    TfNotice::Key				 myNoticeKey;
+
+    // The traversable prims in breadth first order, with the index of the
+    // parent of each prim (-1 for children of the pseudo root). Each level
+    // of the hierarchy starts at the matching entry of myLevelStarts.
+    UT_Array<UsdPrim>				 myPrims;
+    UT_Array<exint>				 myParents;
+    UT_Array<exint>				 myLevelStarts;
+    bool					 myPrimsValid;
+
+    TokenTable					 myKinds;
+    TokenTable					 myModelKinds;
+    UT_Map<TfToken, xusd_TypeEntry, TfToken::HashFunctor> myTypes;
+    TokenTable					 myPurposes;
+    PathTable					 myReferences;
+    PathTable					 myInstances;
+    bool					 myValid[NUM_INDEX_TYPES];
+    UT_Lock					 myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_BoundsHierarchy_h__
+#define __XUSD_BoundsHierarchy_h__
+
+#include "HUSD_API.h"
+#include "HUSD_Utils.h"
+#include "XUSD_PathSet.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_BitArray.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
+#include <UT/UT_StringMap.h>
+#include <UT/UT_UniquePtr.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class XUSD_BoundsHierarchy;
+typedef UT_SharedPtr<XUSD_BoundsHierarchy> XUSD_BoundsHierarchyPtr;
+
+/// A flattened copy of the traversable prim hierarchy of a stage with the
+/// world space aligned bounds of its prims, used to answer bounding box
+/// queries without walking the stage again. The prim hierarchy itself is
+/// the bounding volume hierarchy: a prim's bounds enclose those of its
+/// descendants, so a query stops descending as soon as a prim is entirely
+/// inside or outside the box. Bounds are computed the first time a query
+/// visits a prim, so subtrees that get culled are never computed.
+///
+/// One of these is kept per stage, traversal predicate, and set of
+/// purposes. The hierarchy listens for change notices from its stage.
+/// Resynced subtrees are spliced back in, changes to transforms, extents,
+/// and other properties the bounds depend on throw away the cached bounds,
+/// and changes to any other property are ignored. Bounds are cached for a
+/// few time codes at once, so scrubbing back and forth doesn't recompute
+/// them every time.
+class HUSD_API XUSD_BoundsHierarchy : public TfWeakBase,
+				      UT_NonCopyable
+{
+public:
+			 XUSD_BoundsHierarchy(const UsdStageRefPtr &stage,
+				HUSD_PrimTraversalDemands demands,
+				const TfTokenVector &purposes);
+			~XUSD_BoundsHierarchy();
+
+    /// Return the shared hierarchy for this stage, traversal, and set of
+    /// purposes, creating it if it doesn't exist yet.
+    static XUSD_BoundsHierarchyPtr	 find(const UsdStageRefPtr &stage,
+					HUSD_PrimTraversalDemands demands,
+					const TfTokenVector &purposes);
+
+    /// The stage must be the one this hierarchy was created for.
+    /// Add the paths of prims that match the containment test to the path
+    /// set. Prims entirely inside or entirely outside the box are tested
+    /// without looking at their descendants. Partially contained prims are
+    /// only added if they have no children. If instancer_ids is not null,
+    /// point instancers are tested instance by instance, and the matching
+    /// instance ids are added to this map instead of adding the instancer
+    /// to the path set.
+    void		 findPrims(const UsdStageRefPtr &stage,
+				const GfRange3d &box,
+				const UsdTimeCode &time,
+				bool add_inside,
+				bool add_outside,
+				bool add_partial,
+				XUSD_PathSet &paths,
+				UT_StringMap<UT_Int64Array> *instancer_ids);
+
+    /// The stage this was created for.
+    const UsdStageWeakPtr &stage() const
+			 { return myStage; }
+
+private:
+    class xusd_TimeBounds;
+    class xusd_InstanceBounds;
+
+    enum NodeFlags {
+	NODE_HAS_CHILDREN	= 0x01,
+	NODE_IS_INSTANCER	= 0x02
+    };
+
+    bool			 matches(const UsdStage *stage,
+					HUSD_PrimTraversalDemands demands,
+					const TfTokenVector &purposes) const;
+    void			 objectsChanged(
+					const UsdNotice::ObjectsChanged &notice,
+					const UsdStageWeakPtr &sender);
+
+    void			 update(const UsdStageRefPtr &stage);
+    void			 rebuild(const UsdStageRefPtr &stage);
+    void			 splice(const UsdStageRefPtr &stage,
+					const SdfPath &path,
+					exint node);
+    void			 appendSubtree(const UsdPrim &prim,
+					UT_Array<UsdPrim> &prims,
+					UT_Array<exint> &ends,
+					UT_Array<uint8> &flags) const;
+    void			 rebuildIndex();
+
+    xusd_TimeBounds		*timeBounds(const UsdTimeCode &time);
+    const GfRange3d		&nodeBounds(xusd_TimeBounds &tb,
+					exint node);
+    xusd_InstanceBounds		&instanceBounds(xusd_TimeBounds &tb,
+					exint node);
+    void			 addAllIds(xusd_TimeBounds &tb,
+					exint node,
+					UT_Int64Array &ids);
+    void			 addBoundIds(xusd_TimeBounds &tb,
+					exint node,
+					const GfRange3d &box,
+					bool add_inside,
+					bool add_outside,
+					bool add_partial,
+					UT_Int64Array &ids);
+
+    UsdStageWeakPtr				 myStage;
+    HUSD_PrimTraversalDemands			 myDemands;
+    Usd_PrimFlagsPredicate			 myPredicate;
+    TfTokenVector				 myPurposes;
+    TfNotice::Key				 myNoticeKey;
+
+    // The hierarchy in pre-order. myEnds holds the index one past the last
+    // descendant of each prim, so a whole subtree can be skipped at once.
+    UT_Array<UsdPrim>				 myPrims;
+    UT_Array<exint>				 myEnds;
+    UT_Array<uint8>				 myFlags;
+    UT_Map<SdfPath, exint, SdfPath::Hash>	 myIndex;
+
+    UT_Array<UT_UniquePtr<xusd_TimeBounds> >	 myTimeBounds;
+    SdfPathVector				 myResyncedPaths;
+    exint					 myTimeCounter;
+    bool					 myNeedsRebuild;
+    UT_Lock					 myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -28,6 +28,7 @@
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
 #include "XUSD_DataLock.h"
+#include "XUSD_LayerJournal.h"
 #include "HUSD_Overrides.h"
 #include "XUSD_PathSet.h"
 #include "XUSD_Ticket.h"
@@ -89,6 +90,9 @@ public:
     HUSD_ConstOverridesPtr	 myReadOverrides;
     HUSD_OverridesPtr		 myWriteOverrides;
     SdfLayerRefPtr		 mySessionLayers[HUSD_OVERRIDES_NUM_LAYERS];
+    // The position in the journal of each overrides layer that each of our
+    // session layers matches, or -1 if it doesn't match any.
+    exint			 myJournalPositions[HUSD_OVERRIDES_NUM_LAYERS];
     exint			 myOverridesVersionId;
 };
 
@@ -258,6 +262,10 @@ private:
     HUSD_MirroringType			 myMirroring;
     UsdStageLoadRules                    myMirrorLoadRules;
     bool                                 myMirrorLoadRulesChanged;
+    // Records edits to the source layer returned by editActiveSourceLayer
+    // if the matching stage layer holds a copy of the layer it replaced.
+    UT_UniquePtr<XUSD_LayerJournal>	 myActiveLayerJournal;
+    std::string				 myActiveLayerJournalSource;
     int					 myActiveLayerIndex;
     bool				 myOwnsActiveLayer;
 
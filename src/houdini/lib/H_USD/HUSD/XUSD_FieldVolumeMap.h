@@ -0,0 +1,99 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_FieldVolumeMap_h__
+#define __XUSD_FieldVolumeMap_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_Lock.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_StringArray.h>
+#include <UT/UT_StringMap.h>
+#include <UT/UT_StringSet.h>
+#include <pxr/pxr.h>
+#include <pxr/imaging/hd/types.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class HdChangeTracker;
+
+/// Concurrent multimap from field (bprim) paths to the volume (rprim) paths
+/// that reference them. Volumes register themselves with their fields while
+/// Hydra syncs rprims in parallel, so the map is split into independently
+/// locked shards keyed on the path hash. Two different fields (or volumes)
+/// only contend if they land in the same shard. A reverse map from volume to
+/// fields is kept so removing a volume doesn't have to visit every field.
+class HUSD_API XUSD_FieldVolumeMap : UT_NonCopyable
+{
+public:
+			 XUSD_FieldVolumeMap();
+			~XUSD_FieldVolumeMap();
+
+    /// Record that the volume uses the field. Returns true if this is a new
+    /// association. Safe to call from multiple threads.
+    bool		 addVolumeUsingField(const UT_StringHolder &volume,
+				const UT_StringHolder &field);
+    /// Remove the volume from every field that it was registered with.
+    void		 removeVolume(const UT_StringRef &volume);
+    /// Forget all volumes registered with the field.
+    void		 removeField(const UT_StringRef &field);
+    void		 clear();
+
+    /// Return a snapshot of the volumes using the field.
+    void		 volumesUsingField(const UT_StringRef &field,
+				UT_StringArray &volumes) const;
+    bool		 hasVolumesUsingField(const UT_StringRef &field) const;
+
+    /// Mark every volume that uses the field with the given dirty bits. The
+    /// path conversion is done in parallel, but the change tracker itself is
+    /// not thread-safe, so the rprims are marked serially afterwards.
+    void		 dirtyVolumesUsingField(const UT_StringRef &field,
+				HdChangeTracker &change_tracker,
+				HdDirtyBits bits) const;
+
+private:
+    static constexpr int	 theShardBits = 6;
+    static constexpr int	 theNumShards = 1 << theShardBits;
+
+    struct Shard
+    {
+	mutable UT_Lock			 myLock;
+	UT_StringMap<UT_StringSet>	 myMap;
+    };
+
+    static int		 shardIndex(const UT_StringRef &path)
+			 {
+			     // The low bits are used by the shard's own hash
+			     // table, so pick the shard from the high bits.
+			     return (path.hash() >> (32 - theShardBits)) &
+				    (theNumShards - 1);
+			 }
+
+    Shard		 myFieldShards[theNumShards];
+    Shard		 myVolumeShards[theNumShards];
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
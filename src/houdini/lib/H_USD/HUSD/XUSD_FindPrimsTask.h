@@ -25,8 +25,8 @@
 #include "HUSD_API.h"
 #include "XUSD_PathSet.h"
 #include "XUSD_Utils.h"
+#include <gusd/USD_ThreadedTraverse.h>
 #include <UT/UT_PathPattern.h>
-#include <UT/UT_Task.h>
 #include <UT/UT_ThreadSpecificValue.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/primRange.h>
@@ -60,7 +60,7 @@ private:
     class FindPrimPathsTaskThreadData
     {
     public:
-        SdfPathVector    myPaths;
+        GusdUSD_ThreadedTraverse::ThreadArena<SdfPath>    myPaths;
     };
     typedef UT_ThreadSpecificValue<FindPrimPathsTaskThreadData *>
         FindPrimPathsTaskThreadDataTLS;
@@ -82,7 +82,7 @@ private:
     class FindUsdPrimsTaskThreadData
     {
     public:
-        UT_Array<UsdPrim>    myPrims;
+        GusdUSD_ThreadedTraverse::ThreadArena<UsdPrim>    myPrims;
     };
     typedef UT_ThreadSpecificValue<FindUsdPrimsTaskThreadData *>
         FindUsdPrimsTaskThreadDataTLS;
@@ -90,28 +90,17 @@ private:
     FindUsdPrimsTaskThreadDataTLS    myThreadData;
 };
 
-// Class for performing a multithreaded traversal of a stage guided by a
-// UT_PathPattern. Data is collected into an XUSD_FindPrimsTaskData object
-// by calling its addToThreadData method with all matching prims.
-class HUSD_API XUSD_FindPrimsTask : public UT_Task
-{
-public:
-    XUSD_FindPrimsTask(const UsdPrim& prim,
-            XUSD_FindPrimsTaskData &data,
-            const Usd_PrimFlagsPredicate &predicate,
-            const UT_PathPattern *pattern,
-            const XUSD_SimpleAutoCollection *autocollection);
-
-    UT_Task *run() override;
-
-private:
-    UsdPrim                          myPrim;
-    XUSD_FindPrimsTaskData          &myData;
-    const Usd_PrimFlagsPredicate    &myPredicate;
-    const UT_PathPattern            *myPattern;
-    const XUSD_SimpleAutoCollection *myAutoCollection;
-    bool                             myVisited;
-};
+// Performs a multithreaded traversal of the prims below (and including) prim,
+// guided by a UT_PathPattern or auto collection. Data is collected into an
+// XUSD_FindPrimsTaskData object by calling its addToThreadData method with
+// all matching prims. If neither a pattern nor an auto collection is given,
+// every prim matches. The pseudo root and HoudiniLayerInfo prims are never
+// added.
+HUSD_API void HUSDfindPrims(const UsdPrim &prim,
+        XUSD_FindPrimsTaskData &data,
+        const Usd_PrimFlagsPredicate &predicate,
+        const UT_PathPattern *pattern,
+        const XUSD_SimpleAutoCollection *autocollection);
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_LayerJournal_h__
+#define __XUSD_LayerJournal_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_Lock.h>
+#include <UT/UT_NonCopyable.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/notice.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Records the paths of the specs edited on a layer, so another layer that
+/// holds a copy of it can be brought up to date by copying only the specs
+/// that changed instead of transferring the whole layer. Positions in the
+/// journal only ever increase. If the layer content is replaced or too many
+/// edits pile up, the journal forgets the edits before that point, and any
+/// copy older than that is updated with a full transfer instead.
+class HUSD_API XUSD_LayerJournal : public TfWeakBase,
+				   UT_NonCopyable
+{
+public:
+    explicit		 XUSD_LayerJournal(const SdfLayerHandle &layer);
+			~XUSD_LayerJournal();
+
+    const SdfLayerHandle &layer() const
+			 { return myLayer; }
+
+    /// The current position in the journal. A copy of the layer made now
+    /// should remember this value to pass to update() later.
+    exint		 position() const;
+
+    /// Bring dest up to date with our layer. If dest matched our layer at
+    /// the given position, only the specs edited since then are copied.
+    /// Otherwise the whole layer is transferred. Pass a negative position
+    /// if dest is not known to match any earlier state of our layer.
+    /// Returns the position dest now matches.
+    exint		 update(const SdfLayerHandle &dest,
+				exint position) const;
+
+    /// Number of update() calls that only copied the edited specs, the
+    /// number that fell back to a full transfer, and the total number of
+    /// specs copied by the first kind, over all journals. These are
+    /// reported by HUSD_Info::getCacheStats().
+    static void		 getStats(exint &delta_updates,
+				exint &full_updates,
+				exint &delta_specs);
+
+private:
+    void		 layersChanged(
+				const SdfNotice::LayersDidChangeSentPerLayer &n,
+				const SdfLayerHandle &sender);
+    // Forget all recorded edits. Any position from before this call will
+    // require a full transfer.
+    void		 forget();
+    bool		 copyChanges(const SdfLayerHandle &dest,
+				exint position) const;
+
+    SdfLayerHandle	 myLayer;
+    TfNotice::Key	 myNoticeKey;
+    // The path of each edit, starting with the edit at position myStart.
+    SdfPathVector	 myPaths;
+    exint		 myStart;
+    mutable UT_Lock	 myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -23,6 +23,8 @@
  */
 
 #include "HUSD_Utils.h"
+#include "XUSD_LayerJournal.h"
+#include <UT/UT_UniquePtr.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/layer.h>
 
@@ -37,6 +39,10 @@ public:
 				~XUSD_OverridesData();
 
     const SdfLayerRefPtr	&layer(HUSD_OverridesLayerId layer_id) const;
+    // The record of edits made to one of our layers. Edits made while we
+    // are locked to an XUSD_Data are only recorded once we are unlocked.
+    const XUSD_LayerJournal	&journal(HUSD_OverridesLayerId layer_id) const
+				 { return *myJournal[layer_id]; }
 
     // These methods should only be called by HUSD_Overrides.
     void			 lockToData(XUSD_Data *data);
@@ -45,6 +51,7 @@ public:
 private:
     XUSD_Data			*myLockedToData;
     SdfLayerRefPtr		 myLayer[HUSD_OVERRIDES_NUM_LAYERS];
+    UT_UniquePtr<XUSD_LayerJournal> myJournal[HUSD_OVERRIDES_NUM_LAYERS];
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
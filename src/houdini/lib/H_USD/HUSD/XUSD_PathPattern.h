@@ -63,9 +63,9 @@ public:
 				const HUSD_TimeCode &timecode);
 			~XUSD_PathPattern() override;
 
-    void		 getSpecialTokenPaths(SdfPathSet &collection_paths,
-				SdfPathSet &collection_expanded_paths,
-                                SdfPathSet &collectionless_paths) const;
+    void		 getSpecialTokenPaths(XUSD_PathSet &collection_paths,
+				XUSD_PathSet &collection_expanded_paths,
+                                XUSD_PathSet &collectionless_paths) const;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -27,20 +27,105 @@
 
 #include "HUSD_API.h"
 #include <pxr/usd/sdf/path.h>
+#include <algorithm>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-class HUSD_API XUSD_PathSet : public SdfPathSet
+// A set of SdfPaths stored as a sorted array without duplicates. This is
+// much more compact than a std::set, and makes lookups, iteration, and set
+// operations between two path sets cache friendly. The trade-off is that
+// inserting a single path in the middle of the set is linear in the size of
+// the set. Code that gathers many paths in an arbitrary order should collect
+// them in an SdfPathVector and insert them all at once.
+class HUSD_API XUSD_PathSet
 {
 public:
+    typedef SdfPath                              value_type;
+    typedef SdfPathVector::const_iterator        const_iterator;
+    typedef const_iterator                       iterator;
+
 			 XUSD_PathSet();
+                         XUSD_PathSet(const XUSD_PathSet &src);
+                         XUSD_PathSet(XUSD_PathSet &&src);
                          XUSD_PathSet(const SdfPathSet &src);
+    explicit             XUSD_PathSet(SdfPathVector &&src);
 			~XUSD_PathSet();
 
+    const XUSD_PathSet  &operator=(const XUSD_PathSet &src);
+    const XUSD_PathSet  &operator=(XUSD_PathSet &&src);
     const XUSD_PathSet  &operator=(const SdfPathSet &src);
+    bool                 operator==(const XUSD_PathSet &other) const
+                         { return myPaths == other.myPaths; }
+    bool                 operator!=(const XUSD_PathSet &other) const
+                         { return myPaths != other.myPaths; }
+
+    bool                 empty() const
+                         { return myPaths.empty(); }
+    size_t               size() const
+                         { return myPaths.size(); }
+    void                 clear()
+                         { myPaths.clear(); }
+    void                 swap(XUSD_PathSet &other)
+                         { myPaths.swap(other.myPaths); }
+
+    const_iterator       begin() const
+                         { return myPaths.begin(); }
+    const_iterator       end() const
+                         { return myPaths.end(); }
+    const_iterator       find(const SdfPath &path) const;
+    const_iterator       lower_bound(const SdfPath &path) const;
+    size_t               count(const SdfPath &path) const
+                         { return contains(path) ? 1 : 0; }
+
+    // Single path insertion. Appending a path that sorts after every path
+    // already in the set is constant time.
+    std::pair<const_iterator, bool>
+                         insert(const SdfPath &path);
+    // Hinted insertion, so std::inserter can be used to fill a path set.
+    const_iterator       insert(const_iterator hint, const SdfPath &path);
+    template <typename... Args>
+    std::pair<const_iterator, bool>
+                         emplace(Args &&...args)
+                         { return insert(SdfPath(std::forward<Args>(args)...)); }
+    template <typename InputIterator>
+    void                 insert(InputIterator first, InputIterator last)
+                         { insert(SdfPathVector(first, last)); }
+    // Bulk insertion. The paths are sorted (in parallel if there are enough
+    // of them) and merged with the existing set in a single pass.
+    void                 insert(SdfPathVector &&paths);
+    // Union with another path set, in a single linear merge.
+    void                 insert(const XUSD_PathSet &other);
+
+    size_t               erase(const SdfPath &path);
+    const_iterator       erase(const_iterator it);
+    // Difference with another path set, in a single linear pass.
+    void                 erase(const XUSD_PathSet &other);
+    // Intersection with another path set, in a single linear pass.
+    void                 intersect(const XUSD_PathSet &other);
+    // Remove every path for which the functor returns true.
+    template <typename Func>
+    void                 removeIf(const Func &func)
+                         {
+                             myPaths.erase(std::remove_if(myPaths.begin(),
+                                 myPaths.end(), func), myPaths.end());
+                         }
 
     bool                 contains(const SdfPath &path) const;
     bool                 containsPathOrAncestor(const SdfPath &path) const;
+    bool                 containsAncestor(const SdfPath &path) const;
+    bool                 containsDescendant(const SdfPath &path) const;
+    // Remove any path that has an ancestor also in the set.
+    void                 removeDescendants();
+
+    const SdfPathVector &sdfPathVector() const
+                         { return myPaths; }
+    int64                getMemoryUsage(bool inclusive) const;
+
+private:
+    static void          sortAndRemoveDuplicates(SdfPathVector &paths);
+
+    SdfPathVector        myPaths;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
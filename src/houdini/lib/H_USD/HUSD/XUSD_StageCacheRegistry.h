@@ -0,0 +1,99 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_StageCacheRegistry_h__
+#define __XUSD_StageCacheRegistry_h__
+
+#include <UT/UT_Array.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
+#include <pxr/pxr.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// The shared registry of the per stage caches built to answer queries (see
+// XUSD_AutoCollectionIndex and XUSD_BoundsHierarchy). Entries are kept from
+// least to most recently used, and the least recently used entry is thrown
+// away once there are more than the maximum. Entries for stages that have
+// been destroyed are thrown away on the next lookup. The cache class must
+// provide a stage() method returning the UsdStageWeakPtr it was built for.
+template <typename CACHE>
+class XUSD_StageCacheRegistry : UT_NonCopyable
+{
+public:
+    typedef UT_SharedPtr<CACHE>	 CachePtr;
+
+    explicit		 XUSD_StageCacheRegistry(exint max_entries)
+			     : myMaxEntries(max_entries)
+			 { }
+
+    // Return the first entry for which matches(const CACHE &) returns true,
+    // or add the one returned by create() if there isn't one.
+    template <typename MATCHES, typename CREATE>
+    CachePtr		 find(const MATCHES &matches, const CREATE &create)
+    {
+	UT_Lock::Scope		 lock(myLock);
+	CachePtr		 entry;
+
+	for (exint i = myEntries.size(); i --> 0; )
+	{
+	    if (!myEntries(i)->stage())
+		myEntries.removeIndex(i);
+	}
+
+	for (exint i = 0, n = myEntries.size(); i < n; i++)
+	{
+	    if (matches(*myEntries(i)))
+	    {
+		entry = myEntries(i);
+		myEntries.removeIndex(i);
+		myEntries.append(entry);
+		return entry;
+	    }
+	}
+
+	entry = create();
+	if (myEntries.size() >= myMaxEntries)
+	    myEntries.removeIndex(0);
+	myEntries.append(entry);
+
+	return entry;
+    }
+
+    exint		 entries() const
+    {
+	UT_Lock::Scope		 lock(myLock);
+	return myEntries.size();
+    }
+
+private:
+    UT_Array<CachePtr>	 myEntries;
+    exint		 myMaxEntries;
+    mutable UT_Lock	 myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -403,6 +403,10 @@ HUSDgetBestRefPrimPath(const UT_StringRef &reffilepath,
         UsdStageRefPtr &stage);
 HUSD_API void
 HUSDclearBestRefPathCache(const std::string &layeridentifier = std::string());
+// Clears the cached best ref paths of every layer whose answer was computed
+// from a stage that used the given layer (including the layer itself).
+HUSD_API void
+HUSDclearBestRefPathCacheUsingLayer(const std::string &layeridentifier);
 
 // Functions for checking the amount of time sampling of an attribute/xfrom:
 HUSD_API HUSD_TimeSampling
@@ -46,9 +46,11 @@
 #include <GT/GT_RefineParms.h>
 #include <GU/GU_PrimPacked.h>
 #include <UT/UT_Options.h>
+#include <UT/UT_ParallelUtil.h>
 
 #include "pxr/usd/usdGeom/xformCache.h"
 
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
 
@@ -298,6 +300,47 @@ public:
         const UT_Array<const GU_PrimPacked *>   &myPrims;
     };
 
+    // Packed prims may share an implementation, which lazily caches its USD
+    // prim, transform and bounds. Fill those caches once per implementation
+    // so FillTask only reads them and can run in parallel. Looking up the
+    // USD prim may run the packed USD tracker, so that stays on this thread.
+    // Returns false if any USD prim can't be found, in which case the lookup
+    // would be retried (and the caches written) by every FillTask call.
+    static bool
+    prepareImplementations(const UT_Array<const GU_PrimPacked *> &prims)
+    {
+        UT_Array<const GusdGU_PackedUSD *> impls;
+
+        impls.setCapacity(prims.entries());
+        for (const GU_PrimPacked *prim : prims)
+        {
+            impls.append(UTverify_cast<const GusdGU_PackedUSD *>(
+                prim->sharedImplementation()));
+        }
+        impls.stdsort(std::less<const GusdGU_PackedUSD *>());
+        impls.truncate(std::unique(impls.begin(), impls.end()) -
+                       impls.begin());
+
+        for (const GusdGU_PackedUSD *impl : impls)
+        {
+            if (!impl->getUsdPrim())
+                return false;
+        }
+
+        UTparallelFor(UT_BlockedRange<exint>(0, impls.entries()),
+            [&impls](const UT_BlockedRange<exint> &range)
+            {
+                UT_BoundingBox box;
+                for (exint i = range.begin(); i != range.end(); ++i)
+                {
+                    impls(i)->getUsdTransform();
+                    impls(i)->getBoundsCached(box);
+                }
+            });
+
+        return true;
+    }
+
     void
     addInstances( 
         GT_PrimCollect& collection, 
@@ -375,9 +418,12 @@ public:
 
         if (nbox)
         {
-            //UTparallelFor(UT_BlockedRange<exint>(0, nbox),
-            UTserialFor(UT_BlockedRange<exint>(0, nbox),
-                FillTask(boxes, xforms, _boxPrims));
+            if (prepareImplementations(_boxPrims))
+                UTparallelFor(UT_BlockedRange<exint>(0, nbox),
+                    FillTask(boxes, xforms, _boxPrims));
+            else
+                UTserialFor(UT_BlockedRange<exint>(0, nbox),
+                    FillTask(boxes, xforms, _boxPrims));
             for (exint i = 0; i < nbox; ++i)
             {
                 boxdata.appendBox(boxes[i], xforms[i],
@@ -390,9 +436,12 @@ public:
         }
         if (ncentroid)
         {
-            //UTparallelFor(UT_BlockedRange<exint>(0, ncentroid),
-            UTserialFor(UT_BlockedRange<exint>(0, ncentroid),
-                FillTask(boxes, xforms, _centroidPrims));
+            if (prepareImplementations(_centroidPrims))
+                UTparallelFor(UT_BlockedRange<exint>(0, ncentroid),
+                    FillTask(boxes, xforms, _centroidPrims));
+            else
+                UTserialFor(UT_BlockedRange<exint>(0, ncentroid),
+                    FillTask(boxes, xforms, _centroidPrims));
             for (exint i = 0; i < ncentroid; ++i)
             {
                 boxdata.appendCentroid(boxes[i], xforms[i],
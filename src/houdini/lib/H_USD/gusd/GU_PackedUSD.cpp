@@ -608,7 +608,10 @@ GusdGU_PackedUSD::getUsdTransform() const
         m_transformCacheValid = true;
     }
     else
+    {
         m_transformCache = UT_Matrix4D(1);
+        m_transformCacheValid = true;
+    }
 
     return m_transformCache;
 }
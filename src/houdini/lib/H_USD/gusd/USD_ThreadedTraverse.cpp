@@ -49,14 +49,17 @@ TaskData::GatherPrimsFromThreads(
     exint nPrims = 0;
     for(auto it = threadData.begin(); it != threadData.end(); ++it) {
         if(const auto* tdata = it.get())
-            nPrims += tdata->prims.size();
+            nPrims += tdata->prims.Size();
     }
     prims.setCapacity(nPrims);
 
-    /* Concat the per-thread arrays.*/
+    /* Concat the per-thread arenas.*/
     for(auto it = threadData.begin(); it != threadData.end(); ++it) {
-        if(const auto* tdata = it.get())
-            prims.concat(tdata->prims);
+        if(const auto* tdata = it.get()) {
+            tdata->prims.ForEach(
+                [&](const GusdUSD_Traverse::PrimIndexPair& pair)
+                { prims.append(pair); });
+        }
     }
 
     /* The ordering of prims coming directly from different threads
@@ -84,22 +87,20 @@ TaskData::GatherPrimsFromThreads(UT_Array<UsdPrim>& prims)
     exint nPrims = 0;
     for(auto it = threadData.begin(); it != threadData.end(); ++it) {
         if(const auto* tdata = it.get())
-            nPrims += tdata->prims.size();
+            nPrims += tdata->prims.Size();
     }
         
     /* Pre-allocate all the space we need */
     prims.setCapacity(nPrims);
 
-    /* Concat the per-thread arrays.*/
+    /* Concat the per-thread arenas.*/
     for(auto it = threadData.begin(); it != threadData.end(); ++it) {
         if(const auto* tdata = it.get()) {
             /* Entries are stored in threads as (prim,index) pairs,
                so need to pull the prims separately.*/
-            exint start = prims.size();
-            exint count = tdata->prims.size();
-            prims.setSize(start + count);
-            for(exint i = 0; i < count; ++i)
-                prims(start + i) = tdata->prims(i).first;
+            tdata->prims.ForEach(
+                [&](const GusdUSD_Traverse::PrimIndexPair& pair)
+                { prims.append(pair.first); });
         }
     }
 
@@ -28,8 +28,10 @@
 #include <UT/UT_Array.h>
 #include <UT/UT_Interrupt.h>
 #include <UT/UT_ParallelUtil.h>
-#include <UT/UT_Task.h>
+#include <UT/UT_Thread.h>
 #include <UT/UT_ThreadSpecificValue.h>
+#include <UT/UT_UniquePtr.h>
+#include <SYS/SYS_Math.h>
 
 #include "gusd/UT_Assert.h"
 #include "gusd/USD_Traverse.h"
@@ -107,9 +109,52 @@ DefaultImageablePrimVisitorT<Visitor,Recursive>::AcceptPrim(
 }
 
 
+/** Append-only storage for one thread's results.
+    Entries are kept in blocks that are never reallocated, so growing the
+    arena never copies the entries already stored in it. Blocks start small
+    and double in size, so threads that find few matches stay cheap.*/
+template <typename T>
+class ThreadArena
+{
+public:
+    static const exint  MinBlockSize = 64;
+    static const exint  MaxBlockSize = 16384;
+
+    ThreadArena() : _size(0) {}
+
+    void    Append(const T& item)
+            {
+                if(_blocks.isEmpty() ||
+                   _blocks.last()->size() == _blocks.last()->capacity()) {
+                    exint blockSize = _blocks.isEmpty() ? MinBlockSize :
+                        SYSmin(_blocks.last()->capacity() * 2, MaxBlockSize);
+                    _blocks.append(UTmakeUnique<UT_Array<T>>());
+                    _blocks.last()->setCapacity(blockSize);
+                }
+                _blocks.last()->append(item);
+                ++_size;
+            }
+
+    exint   Size() const    { return _size; }
+
+    /** Call @a fn on every entry, in the order they were appended.*/
+    template <typename Fn>
+    void    ForEach(const Fn& fn) const
+            {
+                for(const auto& block : _blocks)
+                    for(const T& item : *block)
+                        fn(item);
+            }
+
+private:
+    UT_Array<UT_UniquePtr<UT_Array<T>>> _blocks;
+    exint                               _size;
+};
+
+
 struct TaskThreadData
 {
-    UT_Array<GusdUSD_Traverse::PrimIndexPair>   prims;
+    ThreadArena<GusdUSD_Traverse::PrimIndexPair>    prims;
 };
 
 typedef UT_ThreadSpecificValue<TaskThreadData*> TaskThreadDataTLS;
@@ -121,6 +166,16 @@ struct TaskData
 
     TaskThreadDataTLS   threadData;
 
+    /** Add a matching prim to the current thread's list.*/
+    void    AddPrim(const UsdPrim& prim, exint idx)
+            {
+                auto*& tdata = threadData.get();
+                if(!tdata)
+                    tdata = new TaskThreadData;
+                tdata->prims.Append(
+                    GusdUSD_Traverse::PrimIndexPair(prim, idx));
+            }
+
     /** Collect all of the prims from the numerous threads.
         The resulting prims are sorted (for determinism) */
     bool    GatherPrimsFromThreads(UT_Array<UsdPrim>& prims);
@@ -130,93 +185,127 @@ struct TaskData
 };
 
 
-/** Task for traversing a prim tree in parallel.
+/** Batched parallel traversal of a prim tree.
 
-    See DefaultImageablePrimVisitorT<> for an example of the structure
-    expected for visitors. */
-template <class Visitor>
-struct TraverseTaskT : public UT_Task
+    The children of each prim are gathered in a single pass and then visited
+    as ranges of siblings with UTparallelFor, so idle threads steal whole
+    ranges of siblings instead of each child becoming its own task. The
+    grain size grows with the number of siblings, so very wide levels are
+    cut into a bounded number of batches, while small sibling ranges (whose
+    subtrees are likely to be deep) can still be split down to single prims.
+    A prim with only one child continues into it without any task at all.
+
+    @a visit is called as `bool visit(const UsdPrim&)` on every prim, and
+    returns whether to traverse the children of that prim.*/
+template <class VisitFn>
+struct BatchedTraverseT
 {
-    TraverseTaskT(const UsdPrim& prim,  exint idx, UsdTimeCode time,
-                  GusdPurposeSet purposes,
-                  TaskData& data, const Visitor& visitor, bool skipPrim)
-        :  UT_Task(), _prim(prim), _idx(idx), _time(time),
-           _purposes(purposes), _data(data),
-           _visited(false), _visitor(visitor), _skipPrim(skipPrim) {}
+    BatchedTraverseT(const Usd_PrimFlagsPredicate& predicate,
+                     const VisitFn& visit)
+        : _predicate(predicate), _visit(visit),
+          _maxBatches(UT_Thread::getNumProcessors() * BatchesPerThread) {}
 
-    UT_Task*        run() override;
+    void    Traverse(const UsdPrim& prim, bool skipPrim) const;
 
 private:
-    UsdPrim         _prim;
-    exint           _idx;
-    UsdTimeCode     _time;
-    GusdPurposeSet  _purposes;
-    TaskData&       _data;
-    bool            _visited;
-    Visitor         _visitor;
-    bool            _skipPrim;
+    /** Number of batches each thread should get when a range of siblings
+        is wide enough that it can't be split into single prims.*/
+    static const exint  BatchesPerThread = 8;
+
+    exint   GrainSize(exint count) const
+            { return SYSmax(exint(1), count / _maxBatches); }
+
+    const Usd_PrimFlagsPredicate&   _predicate;
+    const VisitFn&                  _visit;
+    const exint                     _maxBatches;
 };
 
 
-/** XXX: This parallel recursion pattern follows the
-    'Recycling Parent as Continuation' pattern from
-    TBB's 'Catalog of Recommend task Patterns' */
-template <class Visitor>
-UT_Task*
-TraverseTaskT<Visitor>::run()
+template <class VisitFn>
+void
+BatchedTraverseT<VisitFn>::Traverse(const UsdPrim& prim, bool skipPrim) const
 {
-    /* XXX: Ended up needing this check at some point.
-            Find out if it's still necessary.*/
-    if(ARCH_UNLIKELY(_visited)) return NULL;
-    _visited = true;
-
-    UT_ASSERT_P(_prim);
-
-    if(!_skipPrim) {
-
-        GusdUSD_TraverseControl ctl;
-        if(ARCH_UNLIKELY(_visitor.AcceptPrim(_prim, _time, _purposes, ctl))) {
-            /* Matched. Add it to the thread-specific list.*/
-            auto*& threadData = _data.threadData.get();
-            if(!threadData)
-                threadData = new TaskThreadData;
-            threadData->prims.append(
-                GusdUSD_Traverse::PrimIndexPair(_prim, _idx));
-        }
-        if(ARCH_UNLIKELY(!ctl.GetVisitChildren())) {
-            return NULL;
+    UsdPrim cur = prim;
+
+    while(true) {
+        UT_ASSERT_P(cur);
+
+        if(!skipPrim && !_visit(cur))
+            return;
+        skipPrim = false;
+
+        auto children = cur.GetFilteredChildren(_predicate);
+        auto it = children.begin();
+        if(it == children.end())
+            return;
+
+        UsdPrim first = *it;
+        if(++it == children.end()) {
+            /* Only child: keep going in this task.*/
+            cur = first;
+            continue;
         }
-    }
 
-    /* Count the children so we can increment the ref count accordingly.*/
-    int count = 0;
-    auto children = _prim.GetFilteredChildren(_visitor.TraversalPredicate());
-    for (auto i = children.begin(); i != children.end(); ++i, ++count) {}
-
-    if(count == 0)
-        return NULL;
-
-    setRefCount(count);
-    recycleAsContinuation();
-
-    const int last = count - 1;
-    int idx = 0;
-    for (const auto& child : 
-          _prim.GetFilteredChildren(_visitor.TraversalPredicate())) {
-        auto& task =
-            *new(allocate_child()) TraverseTaskT(child, _idx, _time, 
-                                                 _purposes, _data,
-                                                 _visitor, /*skip prim*/ false);
-        if(idx == last)
-            return &task;
-        else
-            spawnChild(task);
-        ++idx;
+        UT_Array<UsdPrim> siblings;
+        siblings.append(first);
+        for(; it != children.end(); ++it)
+            siblings.append(*it);
+
+        const exint count = siblings.size();
+        UTparallelFor(UT_BlockedRange<exint>(0, count),
+            [&](const UT_BlockedRange<exint>& r)
+            {
+                for(exint i = r.begin(); i < r.end(); ++i)
+                    Traverse(siblings(i), /*skip prim*/ false);
+            }, /*subscribe ratio*/ 2, GrainSize(count));
+        return;
     }
-    return NULL;
 }
 
 
+/** Traverse the prims below @a root in parallel, calling @a visit on each.
+    See BatchedTraverseT.*/
+template <class VisitFn>
+void
+ParallelTraverse(const UsdPrim& root,
+                 const Usd_PrimFlagsPredicate& predicate,
+                 bool skipRoot,
+                 const VisitFn& visit)
+{
+    BatchedTraverseT<VisitFn>(predicate, visit).Traverse(root, skipRoot);
+}
+
+
+/** Run the visitor on a prim and record it if it matches.
+    Returns whether to traverse the children of the prim.*/
+template <class Visitor>
+struct MatchPrimT
+{
+    MatchPrimT(const Visitor& visitor, exint idx, UsdTimeCode time,
+               GusdPurposeSet purposes, TaskData& data)
+        : _visitor(visitor), _idx(idx), _time(time),
+          _purposes(purposes), _data(data) {}
+
+    bool    operator()(const UsdPrim& prim) const
+            {
+                GusdUSD_TraverseControl ctl;
+                if(ARCH_UNLIKELY(_visitor.AcceptPrim(prim, _time,
+                                                     _purposes, ctl))) {
+                    /* Matched. Add it to the thread-specific list.*/
+                    _data.AddPrim(prim, _idx);
+                }
+                return ctl.GetVisitChildren();
+            }
+
+private:
+    const Visitor&  _visitor;
+    exint           _idx;
+    UsdTimeCode     _time;
+    GusdPurposeSet  _purposes;
+    TaskData&       _data;
+};
+
+
 template <class Visitor>
 bool
 ParallelFindPrims(const UsdPrim& root,
@@ -228,11 +317,8 @@ ParallelFindPrims(const UsdPrim& root,
 {
     TaskData data;
     bool skipPrim = skipRoot || root.GetPath() == SdfPath::AbsoluteRootPath();
-    auto& task =
-        *new(UT_Task::allocate_root())
-        TraverseTaskT<Visitor>(root, -1, time, purposes,
-                               data, visitor, skipPrim);
-    UT_Task::spawnRootAndWait(task);
+    ParallelTraverse(root, visitor.TraversalPredicate(), skipPrim,
+                     MatchPrimT<Visitor>(visitor, -1, time, purposes, data));
     
     if(UTgetInterrupt()->opInterrupt())
         return false;
@@ -264,12 +350,10 @@ struct RunTasksT
                         bool skipPrim = _skipRoot ||
                             prim.GetPath() == SdfPath::AbsoluteRootPath();
 
-                        auto& task =
-                            *new(UT_Task::allocate_root())
-                            TraverseTaskT<Visitor>(prim, i, _times(i),
-                                                   _purposes(i), _data,
-                                                   _visitor, skipPrim);
-                        UT_Task::spawnRootAndWait(task);
+                        ParallelTraverse(prim,
+                            _visitor.TraversalPredicate(), skipPrim,
+                            MatchPrimT<Visitor>(_visitor, i, _times(i),
+                                                _purposes(i), _data));
                     }
                 }
             }
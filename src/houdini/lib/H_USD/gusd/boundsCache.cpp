@@ -30,6 +30,15 @@ PXR_NAMESPACE_OPEN_SCOPE
 using std::cerr;
 using std::endl;
 
+namespace {
+
+// Most caches that are kept for each stage and set of purposes once
+// their queries are done. Enough for one per thread during a parallel
+// query, plus a few frames of motion blur samples when single threaded.
+const exint _MAX_FREE_CACHES = 16;
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /* static */ 
@@ -41,6 +50,9 @@ GusdBoundsCache::GetInstance()
 }
 
 GusdBoundsCache::GusdBoundsCache() 
+    : m_hits(0)
+    , m_misses(0)
+    , m_contention(0)
 {
 }
 
@@ -93,18 +105,30 @@ GusdBoundsCache::_ComputeBound(
 	    ? prim.GetStage()->GetRootLayer()->GetIdentifier()
 	    : prim.GetStage()->GetRootLayer()->GetRealPath() );
 
-    MapType::accessor accessor;
-    if( !m_map.find( accessor, Key( stageId, includedPurposes ))) {
-        m_map.insert( accessor, Key( stageId, includedPurposes ) );
-        accessor->second = new Item( time, includedPurposes );
+    // Only hold on to the map entry long enough to grab the item, so
+    // queries on the same stage don't block each other.
+    ItemHandle item;
+    const Key key( stageId, includedPurposes );
+    {
+        MapType::const_accessor constAccessor;
+        if( m_map.find( constAccessor, key )) {
+            item = constAccessor->second;
+        }
+    }
+    if( !item ) {
+        MapType::accessor accessor;
+        if( m_map.insert( accessor, key )) {
+            accessor->second = new Item( includedPurposes );
+        }
+        item = accessor->second;
     }
-    std::lock_guard<std::mutex> lock(accessor->second->lock);
-    UsdGeomBBoxCache& cache = accessor->second->bboxCache;
 
-    cache.SetTime( time );
+    BBoxCachePtr cache = _Acquire( *item, time );
 
     // boundFunc is either ComputeWorldBound or ComputeLocalBound
-    GfBBox3d primBBox = (cache.*boundFunc)(prim);
+    GfBBox3d primBBox = ((*cache).*boundFunc)(prim);
+
+    _Release( *item, std::move(cache) );
 
     if( !primBBox.GetRange().IsEmpty() ) 
     {
@@ -124,6 +148,84 @@ GusdBoundsCache::_ComputeBound(
     return false;
 }
 
+void
+GusdBoundsCache::_Lock( Item &item )
+{
+    if( !item.lock.tryLock() ) {
+        m_contention.add(1);
+        item.lock.lock();
+    }
+}
+
+GusdBoundsCache::BBoxCachePtr
+GusdBoundsCache::_Acquire( Item &item, UsdTimeCode time )
+{
+    BBoxCachePtr cache;
+
+    _Lock( item );
+
+    // Prefer the most recently used cache at this time.
+    for( exint i = item.freeCaches.size(); i-- > 0; ) {
+        if( item.freeCaches(i)->GetTime() == time ) {
+            cache = std::move( item.freeCaches(i) );
+            item.freeCaches.removeIndex( i );
+            break;
+        }
+    }
+    if( cache ) {
+        item.lock.unlock();
+        m_hits.add(1);
+        return cache;
+    }
+
+    if( !item.freeCaches.isEmpty() ) {
+        cache = std::move( item.freeCaches(0) );
+        item.freeCaches.removeIndex( 0 );
+    }
+    item.lock.unlock();
+    m_misses.add(1);
+
+    // Moving an existing cache to another time outside the lock keeps
+    // the bounds of prims that aren't animated.
+    if( cache ) {
+        cache->SetTime( time );
+    } else {
+        cache.reset( new UsdGeomBBoxCache( time, item.purposes ));
+    }
+    return cache;
+}
+
+void
+GusdBoundsCache::_Release( Item &item, BBoxCachePtr cache )
+{
+    BBoxCachePtr discard;
+
+    _Lock( item );
+    item.freeCaches.append( std::move(cache) );
+    if( item.freeCaches.size() > _MAX_FREE_CACHES ) {
+        // Destroyed once the lock is released.
+        discard = std::move( item.freeCaches(0) );
+        item.freeCaches.removeIndex( 0 );
+    }
+    item.lock.unlock();
+}
+
+void
+GusdBoundsCache::GetStats(Stats &stats) const
+{
+    stats.hits = m_hits.relaxedLoad();
+    stats.misses = m_misses.relaxedLoad();
+    stats.contention = m_contention.relaxedLoad();
+}
+
+void
+GusdBoundsCache::ResetStats()
+{
+    m_hits.store(0);
+    m_misses.store(0);
+    m_contention.store(0);
+}
+
 void
 GusdBoundsCache::Clear()
 {
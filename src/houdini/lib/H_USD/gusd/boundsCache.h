@@ -31,9 +31,13 @@
 
 #include "USD_DataCache.h"
 
+#include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_BoundingBox.h>
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_ConcurrentHashMap.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_UniquePtr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -42,12 +46,28 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// This singleton class keeps a cache per stage and per purpose.
 /// It will be flushed when the stage cache is flushed. 
 ///
-/// Unfortunaly UsdGeomBBoxCaches only store a single frame at
-/// a time. I considered creating a cache per frame but I thought
-/// that would defeat optimizations for non animated geometry.
+/// UsdGeomBBoxCaches only store a single frame at a time and aren't
+/// thread safe, so each stage and purpose keeps a small pool of them.
+/// A query borrows a cache already set to the requested time if one is
+/// free, so several threads can compute bounds at once and alternating
+/// frames (e.g. motion blur samples) don't flush each other. Otherwise
+/// the least recently used cache is moved to the new time, which keeps
+/// the bounds of non animated prims it already computed.
 
 class GusdBoundsCache : public GusdUSD_DataCache {
 public:
+    /// Counters for all queries since the last ResetStats().
+    /// Hits found a free cache at the requested time. Misses had to move
+    /// a cache to another time or create a new one. Contention counts
+    /// queries that had to wait for another thread to borrow or return
+    /// a cache.
+    struct Stats
+    {
+        int64   hits = 0;
+        int64   misses = 0;
+        int64   contention = 0;
+    };
+
     static GusdBoundsCache& GetInstance();
 
     GusdBoundsCache();
@@ -68,6 +88,9 @@ public:
     void Clear() override;
     int64 Clear(const UT_StringSet& stageNames) override;
 
+    void GetStats(Stats &stats) const;
+    void ResetStats();
+
 private:
 
     // Key that hashes the stage file name and a set of purposes.
@@ -106,15 +129,21 @@ private:
         std::size_t         hash;
     };
 
+    typedef UT_UniquePtr<UsdGeomBBoxCache> BBoxCachePtr;
+
     struct Item : public UT_IntrusiveRefCounter<Item>
     {
-        Item( UsdTimeCode time, const TfTokenVector& includedPurposes ) 
-            : bboxCache( time, includedPurposes )
+        Item( const TfTokenVector& includedPurposes ) 
+            : purposes( includedPurposes )
         {
         }
         
-        UsdGeomBBoxCache bboxCache;
-        std::mutex lock;
+        TfTokenVector purposes;
+
+        // Caches not currently borrowed by a query, least recently used
+        // first. Only accessed with lock held.
+        UT_Array<BBoxCachePtr> freeCaches;
+        UT_Lock lock;
     };
 
     typedef GfBBox3d (UsdGeomBBoxCache::*ComputeFunc)(const UsdPrim& prim);
@@ -128,8 +157,16 @@ private:
 
     typedef UT_IntrusivePtr<Item> ItemHandle;
 
+    void         _Lock( Item &item );
+    BBoxCachePtr _Acquire( Item &item, UsdTimeCode time );
+    void         _Release( Item &item, BBoxCachePtr cache );
+
     typedef UT_ConcurrentHashMap<Key,ItemHandle,Key::HashCmp> MapType;
     MapType   m_map;
+
+    SYS_AtomicInt64 m_hits;
+    SYS_AtomicInt64 m_misses;
+    SYS_AtomicInt64 m_contention;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
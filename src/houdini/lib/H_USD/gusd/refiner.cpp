@@ -37,6 +37,8 @@
 #include <GT/GT_GEOPrimPacked.h>
 #include <GT/GT_PrimInstance.h>
 #include <SYS/SYS_Types.h>
+#include <UT/UT_ParallelUtil.h>
+#include <UT/UT_Thread.h>
 
 #include <iostream>
 
@@ -72,6 +74,19 @@ void copyDataArrayItem( GT_DataArrayHandle dstData, GT_DataArrayHandle srcData,
 GT_AttributeListHandle findAndAddStringAttribute( GT_AttributeListHandle attrs,
                                             const std::string& attrName,
                                             const GT_PrimitiveHandle& gtPrim);
+
+// Collects the prims a partition refines to, in order.
+class PrimCollector : public GT_Refine
+{
+public:
+    bool allowThreading() const override { return false; }
+    void addPrimitive( const GT_PrimitiveHandle& prim ) override
+    {
+        prims.push_back( prim );
+    }
+
+    std::vector<GT_PrimitiveHandle> prims;
+};
 }  
 
 GusdRefiner::GusdRefiner(
@@ -89,6 +104,8 @@ GusdRefiner::GusdRefiner(
     , m_isTopLevel( true )
     , m_buildPointInstancer( false )
     , m_buildPrototypes( false )
+    , m_prefixRecord( -1 )
+    , m_pointInstancerTypeSet( false )
 {
 }
 
@@ -132,50 +149,141 @@ GusdRefiner::refineDetail(
         }
     }
     
+    // Only the top level refiner refines in parallel. Refiners for packed
+    // prims are already running in parallel with each other.
+    const bool parallel = m_isTopLevel && !m_collector.m_recording;
+    vector<PrimCollector> partitionPrims( parallel ? partitions.size() : 0 );
+
     // Refine each geometry partition to prims that can be written to USD. 
     // The results are accumulated in buffer in the refiner.
-    for(vector<GA_Range>::const_iterator rangeIt=partitions.begin();
-            rangeIt != partitions.end(); ++rangeIt) {
-
-        const GA_Range& range = *rangeIt;
+    auto refinePartitions = [&]( const UT_BlockedRange<exint>& r ) {
+        for( exint partitionIndex = r.begin();
+                partitionIndex != r.end(); ++partitionIndex ) {
+
+            const GA_Range& range = partitions[partitionIndex];
+
+            // Before we refine we need to decide if we want to coalesce packed
+            // fragments. We will coalesce unless we are writing transform
+            // overlays and the fragment has a name.
+
+            GU_DetailHandleAutoReadLock detailLock( detail );
+
+            bool overlayTransforms = false;
+            GA_AttributeOwner order[] = { GA_ATTRIB_PRIMITIVE, GA_ATTRIB_DETAIL };
+            const GA_Attribute *overTransformsAttr = 
+                detailLock->findAttribute( GUSD_OVERTRANSFORMS_ATTR, order, 2 );
+            if( overTransformsAttr ) {
+                GA_ROHandleI h( overTransformsAttr );
+                if( overTransformsAttr->getOwner() == GA_ATTRIB_DETAIL ) {
+                    overlayTransforms = h.get( GA_Offset(0) );
+                }
+                else {
+                    // assume all prims in the range have the same usdovertransforms
+                    // attribute value
+                    overlayTransforms = h.get( range.begin().getOffset() );
+                }
+            }
+            if( overlayTransforms ) {
+                // prims must be named to overlay transforms
+                const GA_Attribute *primPathAttr = 
+                    detailLock->findPrimitiveAttribute( GUSD_PRIMPATH_ATTR );
+                if( !primPathAttr ) {
+                    overlayTransforms = false;
+                }
+            }
+        
+            GT_RefineParms newRefineParms( refineParms );
+            newRefineParms.setCoalesceFragments( m_refinePackedPrims && !overlayTransforms );
+
+            GT_PrimitiveHandle detailPrim
+                    = GT_GEODetail::makeDetail( detail, &range);
+            if(detailPrim) {
+                if( parallel ) {
+                    detailPrim->refine( partitionPrims[partitionIndex],
+                                        &newRefineParms );
+                }
+                else {
+                    detailPrim->refine(*this, &newRefineParms );
+                }
+            }
+        }
+    };
 
-        // Before we refine we need to decide if we want to coalesce packed
-        // fragments. We will coalesce unless we are writing transform
-        // overlays and the fragment has a name.
+    if( parallel ) {
+        UTparallelForEachNumber( exint(partitions.size()), refinePartitions );
 
-        GU_DetailHandleAutoReadLock detailLock( detail );
+        vector<GT_PrimitiveHandle> prims;
+        for( const PrimCollector& collector : partitionPrims ) {
+            prims.insert( prims.end(),
+                          collector.prims.begin(), collector.prims.end() );
+        }
+        refineInParallel( prims );
+    }
+    else {
+        UTserialFor( UT_BlockedRange<exint>( 0, partitions.size() ),
+                     refinePartitions );
+    }
+}
 
-        bool overlayTransforms = false;
-        GA_AttributeOwner order[] = { GA_ATTRIB_PRIMITIVE, GA_ATTRIB_DETAIL };
-        const GA_Attribute *overTransformsAttr = 
-            detailLock->findAttribute( GUSD_OVERTRANSFORMS_ATTR, order, 2 );
-        if( overTransformsAttr ) {
-            GA_ROHandleI h( overTransformsAttr );
-            if( overTransformsAttr->getOwner() == GA_ATTRIB_DETAIL ) {
-                overlayTransforms = h.get( GA_Offset(0) );
-            }
-            else {
-                // assume all prims in the range have the same usdovertransforms
-                // attribute value
-                overlayTransforms = h.get( range.begin().getOffset() );
-            }
+void
+GusdRefiner::refineInParallel( const vector<GT_PrimitiveHandle>& prims )
+{
+    if( prims.size() < 2 ) {
+        for( const GT_PrimitiveHandle& prim : prims ) {
+            addPrimitive( prim );
         }
-        if( overlayTransforms ) {
-            // prims must be named to overlay transforms
-            const GA_Attribute *primPathAttr = 
-                detailLock->findPrimitiveAttribute( GUSD_PRIMPATH_ATTR );
-            if( !primPathAttr ) {
-                overlayTransforms = false;
+        return;
+    }
+
+    // Split the prims into contiguous batches. Each batch is refined in
+    // order with a refiner set up like this one, recording what is added.
+    // There are a few batches per thread so that uneven prims still
+    // balance, without paying for a refiner and a recording for every prim.
+    struct Fragment {
+        GusdRefinerCollector    collector;
+        TfToken                 pointInstancerType;
+        bool                    pointInstancerTypeSet = false;
+    };
+    const exint numPrims = prims.size();
+    const exint numBatches = SYSmin( numPrims,
+                                     exint(UT_Thread::getNumProcessors()) * 4 );
+    vector<Fragment> fragments( numBatches );
+
+    UTparallelForEachNumber( numBatches,
+            [&]( const UT_BlockedRange<exint>& r ) {
+        for( exint i = r.begin(); i != r.end(); ++i ) {
+            Fragment& fragment = fragments[i];
+            fragment.collector.m_recording = true;
+
+            GusdRefiner refiner( fragment.collector,
+                                 m_pathPrefix,
+                                 m_pathAttrName,
+                                 m_localToWorldXform );
+            refiner.m_refinePackedPrims = m_refinePackedPrims;
+            refiner.m_useUSDIntrinsicNames = m_useUSDIntrinsicNames;
+            refiner.m_forceGroupTopPackedPrim = m_forceGroupTopPackedPrim;
+            refiner.m_buildPointInstancer = m_buildPointInstancer;
+            refiner.m_buildPrototypes = m_buildPrototypes;
+            refiner.m_writeCtrlFlags = m_writeCtrlFlags;
+            refiner.m_refineParms = m_refineParms;
+
+            const exint begin = ( numPrims * i ) / numBatches;
+            const exint end = ( numPrims * ( i + 1 ) ) / numBatches;
+            for( exint primIndex = begin; primIndex != end; ++primIndex ) {
+                refiner.addPrimitive( prims[primIndex] );
             }
-        }
-        
-        GT_RefineParms newRefineParms( refineParms );
-        newRefineParms.setCoalesceFragments( m_refinePackedPrims && !overlayTransforms );
 
-        GT_PrimitiveHandle detailPrim
-                = GT_GEODetail::makeDetail( detail, &range);
-        if(detailPrim) {
-            detailPrim->refine(*this, &newRefineParms );
+            fragment.pointInstancerType = refiner.m_pointInstancerType;
+            fragment.pointInstancerTypeSet = refiner.m_pointInstancerTypeSet;
+        }
+    });
+
+    // Replay the fragments in order, as if the prims had been refined here.
+    for( const Fragment& fragment : fragments ) {
+        m_collector.replay( fragment.collector );
+        if( fragment.pointInstancerTypeSet ) {
+            m_pointInstancerType = fragment.pointInstancerType;
+            m_pointInstancerTypeSet = true;
         }
     }
 }
@@ -294,6 +402,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                     packedUSD->getFileName(), instancerPrimPath).first) {
                     // Get the type name of the usd file to overlay
                     m_pointInstancerType = prim.GetTypeName();
+                    m_pointInstancerTypeSet = true;
             
                     // Make sure to set buildPointInstancer to true if we are overlaying a
                     // point instancer
@@ -326,7 +435,8 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
             if( auto packedUSD = dynamic_cast<const GusdGT_PackedUSD*>( gtPrim.get() )) {
                 // Point instancer from packed usd
                 instancerPrimPath = instancerPrimPath.IsEmpty() ? packedUSD->getSrcPrimPath() : instancerPrimPath;
-                m_collector.addInstPrim( instancerPrimPath, gtPrim );
+                m_collector.addInstPrim( instancerPrimPath, gtPrim, 0,
+                                         m_prefixRecord );
                 return;
             }
             else if( gtPrim->getPrimitiveType() == GT_PRIM_INSTANCE ) {
@@ -339,7 +449,8 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                 // TODO: If we put all geometry packed prims here, then we break
                 // grouping prims for purpose
                 for( size_t i = 0; i < instPrim->entries(); ++i ) {
-                    m_collector.addInstPrim( instancerPrimPath, gtPrim, i );
+                    m_collector.addInstPrim( instancerPrimPath, gtPrim, i,
+                                             m_prefixRecord );
                 }
                 return;
             }
@@ -441,6 +552,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                 newCtm = m* m_localToWorldXform;
 
                 SdfPath newPath = m_pathPrefix;
+                int64 newPrefixRecord = m_prefixRecord;
                 bool recurse = true;
 
                 if( primHasNameAttr || 
@@ -456,7 +568,11 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                                                 gtPrim,
                                                 newCtm,
                                                 purpose,
-                                                m_writeCtrlFlags );
+                                                m_writeCtrlFlags,
+                                                m_prefixRecord );
+                    if( m_collector.m_recording ) {
+                        newPrefixRecord = m_collector.m_recorded.size() - 1;
+                    }
             
                     // If we are just writing transforms and encounter a packed prim, we 
                     // just want to write it's transform and not refine it further.
@@ -473,6 +589,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                     childRefiner.m_refinePackedPrims = refinePackedPrims;
                     childRefiner.m_forceGroupTopPackedPrim = m_forceGroupTopPackedPrim;
                     childRefiner.m_isTopLevel = false;
+                    childRefiner.m_prefixRecord = newPrefixRecord;
 
                     childRefiner.m_writeCtrlFlags = m_writeCtrlFlags;
                     childRefiner.m_writeCtrlFlags.update( geometry );
@@ -504,7 +621,8 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                          gtPrim,
                          newCtm,
                          purpose,
-                         m_writeCtrlFlags );
+                         m_writeCtrlFlags,
+                         m_prefixRecord );
     }
     else {
         gtPrim->refine( *this, &m_refineParms );
@@ -518,8 +636,24 @@ GusdRefinerCollector::add(
     GT_PrimitiveHandle          prim,
     const UT_Matrix4D&          xform,
     const TfToken &             purpose,
-    const GusdWriteCtrlFlags&   writeCtrlFlagsIn )
+    const GusdWriteCtrlFlags&   writeCtrlFlagsIn,
+    int64                       prefixRecord )
 {
+    if( m_recording ) {
+        RecordedEntry entry;
+        entry.path = path;
+        entry.prim = prim;
+        entry.xform = xform;
+        entry.purpose = purpose;
+        entry.writeCtrlFlags = writeCtrlFlagsIn;
+        entry.prefixRecord = prefixRecord;
+        entry.index = 0;
+        entry.addNumericSuffix = addNumericSuffix;
+        entry.isInstPrim = false;
+        m_recorded.push_back( entry );
+        return path;
+    }
+
     // Update the write control flags from the attributes on the prim
     GusdWriteCtrlFlags writeCtrlFlags = writeCtrlFlagsIn;
 
@@ -562,6 +696,42 @@ GusdRefinerCollector::add(
     return newPath;
 }
 
+void
+GusdRefinerCollector::replay( const GusdRefinerCollector& recording )
+{
+    // The paths that recorded adds were given by this collector.
+    vector<SdfPath> paths( recording.m_recorded.size() );
+
+    for( size_t i = 0; i < recording.m_recorded.size(); ++i ) {
+
+        const RecordedEntry& entry = recording.m_recorded[i];
+
+        // The path was built from the path returned by the recorded add
+        // of a parent group, which may have been given a numeric suffix.
+        SdfPath path = entry.path;
+        if( entry.prefixRecord >= 0 ) {
+            const SdfPath& recordedPrefix = 
+                recording.m_recorded[entry.prefixRecord].path;
+            if( path.HasPrefix( recordedPrefix )) {
+                path = path.ReplacePrefix( recordedPrefix,
+                                           paths[entry.prefixRecord] );
+            }
+        }
+
+        if( entry.isInstPrim ) {
+            addInstPrim( path, entry.prim, entry.index );
+        }
+        else {
+            paths[i] = add( path,
+                            entry.addNumericSuffix,
+                            entry.prim,
+                            entry.xform,
+                            entry.purpose,
+                            entry.writeCtrlFlags );
+        }
+    }
+}
+
 void
 GusdRefinerCollector::finish( GusdRefiner& refiner )
 {
@@ -765,8 +935,21 @@ GusdRefinerCollector::finish( GusdRefiner& refiner )
 }
 
 void 
-GusdRefinerCollector::addInstPrim( const SdfPath &path, GT_PrimitiveHandle p, int index )
+GusdRefinerCollector::addInstPrim( const SdfPath &path, GT_PrimitiveHandle p, int index,
+                                   int64 prefixRecord )
 {
+    if( m_recording ) {
+        RecordedEntry entry;
+        entry.path = path;
+        entry.prim = p;
+        entry.prefixRecord = prefixRecord;
+        entry.index = index;
+        entry.addNumericSuffix = false;
+        entry.isInstPrim = true;
+        m_recorded.push_back( entry );
+        return;
+    }
+
     // When we are building point instancers, the refiner collects prims 
     // that can be instances until finish is called.
     //
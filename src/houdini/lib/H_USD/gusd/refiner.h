@@ -60,6 +60,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// The gprim array can contain prims from several OBJ nodes. The obj nodes provide
 /// a coordinate space and a set of options. We stash this stuff with the prims
 /// in the prim array.
+///
+/// A top level refiner refines the prims of a detail in parallel. Each prim
+/// the detail refines to is refined by its own refiner into a collector that
+/// only records what was added. The recordings are then replayed in order
+/// into the real collector, so the prim paths and their ordering are the
+/// same as refining serially.
 
 
 class GusdRefinerCollector;
@@ -111,6 +117,8 @@ public:
 
     ~GusdRefiner() override {}
 
+    // Each refiner adds prims in order. Parallelism is handled by
+    // refineDetail() giving prims to separate refiners.
     bool allowThreading() const override { return false; }
 
     void addPrimitive( const GT_PrimitiveHandle& gtPrim ) override;
@@ -162,9 +170,21 @@ private:
     // modifying to be a valid Usd prim path.
     std::string createPrimPath( const std::string& primName);
 
+    // Refine the prims of a top level detail in parallel. The prims are
+    // the first level of refinement of each partition, in order.
+    void refineInParallel( const std::vector<GT_PrimitiveHandle>& prims );
+
     // Place to collect refined prims
     GusdRefinerCollector&   m_collector;
 
+    // If the collector is recording, the index of the recorded entry 
+    // that created m_pathPrefix, or -1 if it wasn't created by this
+    // collector.
+    int64                   m_prefixRecord;
+
+    // True if m_pointInstancerType was set by this refiner.
+    bool                    m_pointInstancerTypeSet;
+
     // Refine parms are passed to refineDetail and then held on to.
     GT_RefineParms          m_refineParms; 
 
@@ -210,18 +230,41 @@ public:
         InstPrimEntry( GT_PrimitiveHandle p, int i=0 ) : prim( p ), index(i) {}
     };
 
+    // Struct to store the arguments of add and addInstPrim calls in
+    // when recording. prefixRecord is the index of the recorded add that
+    // created the prefix of path, or -1.
+    struct RecordedEntry {
+        SdfPath             path;
+        GT_PrimitiveHandle  prim;
+        UT_Matrix4D         xform;
+        TfToken             purpose;
+        GusdWriteCtrlFlags  writeCtrlFlags;
+        int64               prefixRecord;
+        int                 index;
+        bool                addNumericSuffix;
+        bool                isInstPrim;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
 
+    // When recording, path is returned unchanged.
     SdfPath add( 
         const SdfPath&              path,
         bool                        explicitPrimPath,
         GT_PrimitiveHandle          prim,
         const UT_Matrix4D&          xform,
         const TfToken &             purpose,
-        const GusdWriteCtrlFlags&   writeCtrlFlags );
+        const GusdWriteCtrlFlags&   writeCtrlFlags,
+        int64                       prefixRecord = -1 );
 
     /// Add a prim to be added to a point instancer during finish
-    void addInstPrim( const SdfPath& path, GT_PrimitiveHandle p, int index=0 );
+    void addInstPrim( const SdfPath& path, GT_PrimitiveHandle p, int index=0,
+                      int64 prefixRecord = -1 );
+
+    // Add everything recorded by another collector in the order it was
+    // recorded. Paths of prims under a recorded prim are renamed to match
+    // the name that prim is given by this collector.
+    void replay( const GusdRefinerCollector& recording );
 
     // Complete refining all prims.
     // When constructing point instancers, the refiner/collector gathers and 
@@ -242,6 +285,11 @@ public:
     // sort the prims. If a prim does note have a srcPrimPath, it is added to 
     // a entry with a empty path.
     std::map<SdfPath,std::vector<InstPrimEntry>> m_instancePrims;
+
+    // If true, add and addInstPrim only record their arguments in
+    // m_recorded to be replayed into another collector.
+    bool m_recording = false;
+    std::vector<RecordedEntry> m_recorded;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE